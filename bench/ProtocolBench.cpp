@@ -0,0 +1,114 @@
+/**
+ * @file ProtocolBench.cpp
+ * @brief Throughput benchmark of the server message parser
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * Parses a mix of protocol lines shaped like a busy game (mostly ppo, bct and
+ * pin) in a loop and reports messages per second on one core. Heap
+ * allocations made while parsing are counted through the global operator new
+ * and must stay at zero.
+ *
+ * Built only with -DZAPPY_GUI_BUILD_BENCH=ON:
+ *     ./zappy_protocol_bench [iterations]
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** ProtocolBench.cpp
+*/
+
+#include "../src/protocol/Protocol.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::atomic<std::size_t> g_allocations{0};
+
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief Builds the lines parsed by the benchmark
+ *
+ * @param count Number of lines to generate
+ * @return std::vector<std::string> Lines without trailing newline
+ */
+static std::vector<std::string> make_lines(std::size_t count)
+{
+    std::vector<std::string> lines;
+    lines.reserve(count);
+
+    for (std::size_t i = 0; i < count; i++) {
+        const std::string id = std::to_string(i % 512);
+        const std::string x = std::to_string(i % 97);
+        const std::string y = std::to_string((i * 7) % 89);
+        switch (i % 10) {
+            case 0: case 1: case 2: case 3:
+                lines.push_back("ppo #" + id + " " + x + " " + y + " " + std::to_string(i % 4 + 1));
+                break;
+            case 4: case 5: case 6:
+                lines.push_back("bct " + x + " " + y + " 1 0 2 0 0 1 0");
+                break;
+            case 7:
+                lines.push_back("pin #" + id + " " + x + " " + y + " 10 1 0 3 0 0 2");
+                break;
+            case 8:
+                lines.push_back("pgt #" + id + " " + std::to_string(i % 7));
+                break;
+            default:
+                lines.push_back("pbc #" + id + " hello team, meet at " + x + " " + y);
+                break;
+        }
+    }
+    return lines;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50;
+    const std::vector<std::string> lines = make_lines(100000);
+    std::size_t invalid = 0;
+    std::size_t checksum = 0;
+
+    const std::size_t before = g_allocations.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t it = 0; it < iterations; it++) {
+        for (const std::string &line : lines) {
+            const GUI::Protocol::Message message = GUI::Protocol::parse(line);
+            checksum += message.index();
+            if (std::holds_alternative<GUI::Protocol::Invalid>(message))
+                invalid++;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const std::size_t allocations = g_allocations.load() - before;
+
+    const double total = static_cast<double>(iterations * lines.size());
+    std::cout << "parsed " << static_cast<std::size_t>(total) << " messages in "
+              << elapsed.count() << " s: " << total / elapsed.count() / 1e6
+              << " M messages/s (checksum " << checksum << ")" << std::endl;
+    std::cout << "invalid: " << invalid << ", heap allocations while parsing: " << allocations << std::endl;
+    return invalid == 0 && allocations == 0 ? 0 : 1;
+}
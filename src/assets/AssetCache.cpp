@@ -0,0 +1,355 @@
+/**
+ * @file AssetCache.cpp
+ * @brief Implementation of the AssetCache class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the AssetCache class. Loading
+ * goes through the raylib-cpp wrappers, which throw on failure; the error
+ * is logged once and the path cached as missing.
+ *
+ * Workers never call raylib file functions: they read files with the
+ * standard library and decode sounds with LoadWaveFromMemory(), which
+ * touches no shared state. Models are only read off the main thread: a
+ * preloaded model is parsed and uploaded on the main thread by LoadModel(),
+ * with a file data callback installed for the duration of the call that
+ * serves the bytes a worker already read.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** AssetCache.cpp
+*/
+
+#include "AssetCache.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "../log/Logger.hpp"
+
+namespace {
+
+    const std::string *staged_path = nullptr;
+    const std::vector<unsigned char> *staged_bytes = nullptr;
+
+    /**
+     * @brief Reads a whole file
+     *
+     * @param path Path of the file
+     * @param bytes Receives the content
+     * @return false if the file could not be read
+     */
+    bool read_file(const char *path, std::vector<unsigned char> &bytes)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            return false;
+
+        const std::streamsize size = file.tellg();
+        if (size <= 0)
+            return false;
+        bytes.resize(static_cast<std::size_t>(size));
+        file.seekg(0);
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(bytes.data()), size));
+    }
+
+    /**
+     * @brief File data callback serving the model being built from memory
+     *
+     * Other files (the external buffers of a .gltf) are read from disk.
+     * raylib frees the returned buffer with MemFree().
+     */
+    unsigned char *load_staged(const char *fileName, int *dataSize)
+    {
+        std::vector<unsigned char> disk;
+        const std::vector<unsigned char> *bytes = staged_bytes;
+
+        *dataSize = 0;
+        if (staged_path == nullptr || *staged_path != fileName) {
+            if (!read_file(fileName, disk))
+                return nullptr;
+            bytes = &disk;
+        }
+        auto *data = static_cast<unsigned char *>(MemAlloc(static_cast<unsigned int>(bytes->size())));
+        if (data == nullptr)
+            return nullptr;
+        std::memcpy(data, bytes->data(), bytes->size());
+        *dataSize = static_cast<int>(bytes->size());
+        return data;
+    }
+} // namespace
+
+/**
+ * @brief Destructor of the AssetCache class
+ *
+ * Stops the workers after their current file and frees the sounds decoded
+ * but never turned into assets.
+ */
+GUI::AssetCache::~AssetCache()
+{
+    _cancelled = true;
+    joinWorkers();
+    for (std::vector<Decoded> *list : {&_decoded, &_ready}) {
+        for (Decoded &decoded : *list) {
+            if (decoded.wave.data != nullptr)
+                UnloadWave(decoded.wave);
+        }
+    }
+}
+
+/**
+ * @brief Starts loading files in the background
+ *
+ * Files already loaded or queued are skipped. Workers from an earlier call
+ * are joined first, so this may wait for them to finish their files.
+ *
+ * @param models Paths of the model files
+ * @param sounds Paths of the sound files
+ */
+void GUI::AssetCache::preload(const std::vector<std::string> &models, const std::vector<std::string> &sounds)
+{
+    joinWorkers();
+    _jobs.clear();
+    _nextJob = 0;
+    _cancelled = false;
+
+    for (const std::string &path : models) {
+        if (_models.count(path) == 0 && _pending.insert(path).second)
+            _jobs.push_back({path, false});
+    }
+    for (const std::string &path : sounds) {
+        if (_sounds.count(path) == 0 && _pending.insert(path).second)
+            _jobs.push_back({path, true});
+    }
+    if (_jobs.empty())
+        return;
+
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t count = std::min({MAX_WORKERS, _jobs.size(), hardware});
+    for (std::size_t i = 0; i < count; i++)
+        _workers.emplace_back(&AssetCache::work, this);
+    ZLOG_INFO(Core, "Loading %zu asset files on %zu threads", _jobs.size(), count);
+}
+
+/**
+ * @brief Worker thread body: reads queued files, and decodes the sounds, until none is left
+ */
+void GUI::AssetCache::work()
+{
+    while (!_cancelled) {
+        const std::size_t index = _nextJob.fetch_add(1);
+        if (index >= _jobs.size())
+            return;
+
+        const Job &job = _jobs[index];
+        Decoded decoded;
+        std::vector<unsigned char> bytes;
+
+        decoded.path = job.path;
+        decoded.sound = job.sound;
+        if (read_file(job.path.c_str(), bytes)) {
+            if (job.sound)
+                decoded.wave = LoadWaveFromMemory(GetFileExtension(job.path.c_str()), bytes.data(), static_cast<int>(bytes.size()));
+            else
+                decoded.bytes = std::move(bytes);
+        }
+
+        std::lock_guard<std::mutex> lock(_decodedMutex);
+        _decoded.push_back(std::move(decoded));
+    }
+}
+
+/**
+ * @brief Waits for the workers to exit
+ */
+void GUI::AssetCache::joinWorkers()
+{
+    for (std::thread &worker : _workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+    _workers.clear();
+}
+
+/**
+ * @brief Turns the files the workers finished into assets
+ *
+ * Called once per frame on the main thread, with the window and the audio
+ * device open. Every decoded sound is finished, but at most
+ * MODELS_PER_UPDATE models, so a frame never stalls on more than one GPU
+ * upload. The workers are joined once nothing is pending.
+ *
+ * @return true if at least one asset became available
+ */
+bool GUI::AssetCache::update()
+{
+    {
+        std::lock_guard<std::mutex> lock(_decodedMutex);
+        for (Decoded &decoded : _decoded)
+            _ready.push_back(std::move(decoded));
+        _decoded.clear();
+    }
+
+    bool changed = false;
+    std::size_t models = 0;
+    for (std::size_t i = 0; i < _ready.size(); ) {
+        Decoded &decoded = _ready[i];
+        if (!decoded.sound && models == MODELS_PER_UPDATE) {
+            i++;
+            continue;
+        }
+        if (decoded.sound) {
+            finishSound(decoded);
+        } else {
+            finishModel(decoded);
+            models++;
+        }
+        _ready.erase(_ready.begin() + static_cast<std::ptrdiff_t>(i));
+        changed = true;
+    }
+
+    if (_pending.empty() && !_workers.empty())
+        joinWorkers();
+    return changed;
+}
+
+/**
+ * @brief Builds a model from the bytes a worker read, and caches it
+ *
+ * @param decoded File read by a worker
+ */
+void GUI::AssetCache::finishModel(Decoded &decoded)
+{
+    ModelHandle model;
+
+    if (decoded.bytes.empty()) {
+        ZLOG_ERROR(Render, "Failed to read model %s", decoded.path.c_str());
+    } else {
+        staged_path = &decoded.path;
+        staged_bytes = &decoded.bytes;
+        SetLoadFileDataCallback(load_staged);
+        try {
+            model = std::make_shared<const raylib::Model>(decoded.path);
+            _loads++;
+            ZLOG_DEBUG(Render, "Loaded model %s", decoded.path.c_str());
+        } catch (const std::exception &e) {
+            ZLOG_ERROR(Render, "Failed to load model %s: %s", decoded.path.c_str(), e.what());
+        }
+        SetLoadFileDataCallback(nullptr);
+        staged_path = nullptr;
+        staged_bytes = nullptr;
+    }
+    _models[decoded.path] = model;
+    _pending.erase(decoded.path);
+    _modelRevision++;
+}
+
+/**
+ * @brief Turns a wave a worker decoded into a sound, and caches it
+ *
+ * @param decoded File decoded by a worker; its wave is freed
+ */
+void GUI::AssetCache::finishSound(Decoded &decoded)
+{
+    SoundHandle sound;
+
+    if (decoded.wave.data == nullptr) {
+        ZLOG_ERROR(Audio, "Failed to decode sound %s", decoded.path.c_str());
+    } else {
+        try {
+            sound = std::make_shared<raylib::Sound>(decoded.wave);
+            _loads++;
+            ZLOG_DEBUG(Audio, "Loaded sound %s", decoded.path.c_str());
+        } catch (const std::exception &e) {
+            ZLOG_ERROR(Audio, "Failed to load sound %s: %s", decoded.path.c_str(), e.what());
+        }
+        UnloadWave(decoded.wave);
+        decoded.wave = Wave{};
+    }
+    _sounds[decoded.path] = sound;
+    _pending.erase(decoded.path);
+}
+
+/**
+ * @brief Returns the model stored at a path, loading it the first time
+ *
+ * Must be called while the window (GL context) exists. A path queued by
+ * preload() is not loaded here: it stays null until update() built it.
+ *
+ * @param path Path of the model file
+ * @return The shared model, or nullptr if the file could not be loaded or
+ *         is still loading
+ */
+GUI::AssetCache::ModelHandle GUI::AssetCache::getModel(const std::string &path)
+{
+    auto it = _models.find(path);
+    if (it != _models.end())
+        return it->second;
+    if (_pending.count(path) != 0)
+        return nullptr;
+
+    ModelHandle model;
+    try {
+        model = std::make_shared<const raylib::Model>(path);
+        _loads++;
+        ZLOG_DEBUG(Render, "Loaded model %s", path.c_str());
+    } catch (const std::exception &e) {
+        ZLOG_ERROR(Render, "Failed to load model %s: %s", path.c_str(), e.what());
+    }
+    _models.emplace(path, model);
+    return model;
+}
+
+/**
+ * @brief Returns the sound stored at a path, loading it the first time
+ *
+ * Must be called while the audio device is open. A path queued by
+ * preload() is not loaded here: it stays null until update() built it.
+ *
+ * @param path Path of the sound file
+ * @return The shared sound, or nullptr if the file could not be loaded or
+ *         is still loading
+ */
+GUI::AssetCache::SoundHandle GUI::AssetCache::getSound(const std::string &path)
+{
+    auto it = _sounds.find(path);
+    if (it != _sounds.end())
+        return it->second;
+    if (_pending.count(path) != 0)
+        return nullptr;
+
+    SoundHandle sound;
+    try {
+        sound = std::make_shared<raylib::Sound>(path);
+        _loads++;
+        ZLOG_DEBUG(Audio, "Loaded sound %s", path.c_str());
+    } catch (const std::exception &e) {
+        ZLOG_ERROR(Audio, "Failed to load sound %s: %s", path.c_str(), e.what());
+    }
+    _sounds.emplace(path, sound);
+    return sound;
+}
+
+/**
+ * @brief Drops the cache's references to the models
+ *
+ * Models nobody else holds are freed right away; the next getModel() of
+ * their path loads them again.
+ */
+void GUI::AssetCache::clearModels()
+{
+    _models.clear();
+}
+
+/**
+ * @brief Drops the cache's references to the sounds
+ *
+ * Sounds nobody else holds are freed right away; the next getSound() of
+ * their path loads them again.
+ */
+void GUI::AssetCache::clearSounds()
+{
+    _sounds.clear();
+}
@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** AssetCache.hpp
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../../include/raylib-cpp.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Models and sounds loaded from disk, once per path
+     *
+     * The first request for a path loads the file; every later one returns
+     * the same shared handle, so rebuilding the Map on msz or reconnecting
+     * never reads a file again. A file that failed to load is remembered as
+     * missing (a null handle) and not retried.
+     *
+     * preload() hands a list of files to worker threads while the main
+     * thread runs. Only sounds are decoded off the main thread: the workers
+     * read every file, decode the WAVs, and leave the model files as raw
+     * bytes. raylib parses a model (glTF, embedded textures) and uploads it
+     * to the GPU in one call that must run on the main thread, so the
+     * workers only save it the disk read. update(), called once per frame
+     * on the main thread, turns what they finished into assets: every
+     * decoded sound, and at most MODELS_PER_UPDATE models, each parsed from
+     * memory there. A large model still stalls the frame it is built in.
+     * Until then, getModel() and getSound() return a null handle for a
+     * preloaded path instead of blocking, and callers draw a placeholder;
+     * getModelRevision() changes whenever a model becomes available (sounds
+     * do not change it: they are fetched when played).
+     *
+     * The cache keeps its own reference to everything it loaded; an asset is
+     * freed when the cache dropped it and the last handle is gone. Models
+     * live in GPU memory and sounds in the audio device: clearModels() must
+     * be called while the window exists, and clearSounds() before the audio
+     * device is closed.
+     */
+    class AssetCache {
+        public:
+            using ModelHandle = std::shared_ptr<const raylib::Model>;
+            using SoundHandle = std::shared_ptr<raylib::Sound>;
+
+            static constexpr std::size_t MODELS_PER_UPDATE = 1;
+            static constexpr std::size_t MAX_WORKERS = 4;
+
+            AssetCache() = default;
+            ~AssetCache();
+
+            AssetCache(const AssetCache &) = delete;
+            AssetCache &operator=(const AssetCache &) = delete;
+
+            void preload(const std::vector<std::string> &models, const std::vector<std::string> &sounds);
+            bool update();
+            ModelHandle getModel(const std::string &path);
+            SoundHandle getSound(const std::string &path);
+            void clearModels();
+            void clearSounds();
+
+            [[nodiscard]] bool isLoading() const { return !_pending.empty(); }
+            [[nodiscard]] std::uint64_t getModelRevision() const { return _modelRevision; }
+            [[nodiscard]] std::size_t getLoadCount() const { return _loads; }
+
+        private:
+            struct Job {
+                std::string path;
+                bool sound = false;
+            };
+
+            struct Decoded {
+                std::string path;
+                bool sound = false;
+                std::vector<unsigned char> bytes;    // model file
+                Wave wave{};                         // decoded sound
+            };
+
+            void work();
+            void joinWorkers();
+            void finishModel(Decoded &decoded);
+            void finishSound(Decoded &decoded);
+
+            std::unordered_map<std::string, ModelHandle> _models;
+            std::unordered_map<std::string, SoundHandle> _sounds;
+            std::unordered_set<std::string> _pending;
+            std::vector<Decoded> _ready;
+            std::size_t _loads = 0;
+            std::uint64_t _modelRevision = 0;
+
+            std::vector<Job> _jobs;
+            std::atomic<std::size_t> _nextJob{0};
+            std::atomic<bool> _cancelled{false};
+            std::vector<std::thread> _workers;
+            std::mutex _decodedMutex;
+            std::vector<Decoded> _decoded;    // guarded by _decodedMutex
+    };
+} // namespace GUI
@@ -15,6 +15,7 @@
  */
 
 #include "Audio.hpp"
+#include <algorithm>
 
 /**
  * @brief Constructs a new AudioManager object and initializes the audio system
@@ -30,23 +31,38 @@
  * The audio device initialization is handled by Raylib's InitAudioDevice()
  * which sets up the audio context and prepares the system for sound playback.
  *
- * @note The constructor will attempt to load all audio files from the assets directory
- * @note If audio files are missing, the sound objects may not function correctly
+ * Only the file of each name is recorded: sounds are taken from the asset
+ * cache when played, so a file used for several names (deathPlayer.wav) is
+ * loaded once, and getFiles() lets the caller preload them in the
+ * background.
+ *
+ * @note If an audio file is missing, its name plays nothing
  * @note The audio device must be properly initialized before any sound operations
- * @note Memory for sound assets is allocated during construction
+ *
+ * @param assets Cache the sounds are loaded through
  *
  * @throws May throw exceptions if audio device initialization fails
- * @throws May throw exceptions if sound file loading fails
  */
-GUI::AudioManager::AudioManager() {
+GUI::AudioManager::AudioManager(AssetCache &assets) : _assets(assets) {
     InitAudioDevice();
-    _sounds.emplace("newPlayer", raylib::Sound("assets/newPlayer.wav"));
-    _sounds.emplace("playerExpulsion", raylib::Sound("assets/deathPlayer.wav"));
-    _sounds.emplace("broadcast", raylib::Sound("assets/broadcast.wav"));
-    _sounds.emplace("incantationStart", raylib::Sound("assets/raaaah.wav"));
-    _sounds.emplace("incantationEnd", raylib::Sound("assets/incantationEnd.wav"));
-    _sounds.emplace("deathPlayer", raylib::Sound("assets/deathPlayer.wav"));
-    _sounds.emplace("endGame", raylib::Sound("assets/endGame.wav"));
+    _files.emplace("newPlayer", "assets/newPlayer.wav");
+    _files.emplace("playerExpulsion", "assets/deathPlayer.wav");
+    _files.emplace("broadcast", "assets/broadcast.wav");
+    _files.emplace("incantationStart", "assets/raaaah.wav");
+    _files.emplace("incantationEnd", "assets/incantationEnd.wav");
+    _files.emplace("deathPlayer", "assets/deathPlayer.wav");
+    _files.emplace("endGame", "assets/endGame.wav");
+}
+
+/**
+ * @brief Destroys the AudioManager object and closes the audio device
+ *
+ * The asset cache's sounds are freed first: a sound must not outlive the
+ * device it was loaded on.
+ */
+GUI::AudioManager::~AudioManager() {
+    _assets.clearSounds();
+    CloseAudioDevice();
 }
 
 /**
@@ -68,6 +84,7 @@ GUI::AudioManager::AudioManager() {
  *
  * @note The method performs case-sensitive string matching
  * @note If the sound name doesn't exist, no error is reported
+ * @note A sound still loading in the background plays nothing
  * @note Multiple simultaneous playbacks of the same sound are supported
  * @note The method is safe to call with invalid sound names
  * @note Sound playback is asynchronous and non-blocking
@@ -82,8 +99,27 @@ GUI::AudioManager::AudioManager() {
  * @endcode
  */
 void GUI::AudioManager::play(const std::string &name) {
-    auto it = _sounds.find(name);
-    if (it != _sounds.end()) {
-        it->second.Play();
+    auto it = _files.find(name);
+    if (it == _files.end())
+        return;
+
+    const AssetCache::SoundHandle sound = _assets.getSound(it->second);
+    if (sound) {
+        sound->Play();
+    }
+}
+
+/**
+ * @brief Returns the sound files the names map to
+ *
+ * @return One path per file, even when several names share it
+ */
+std::vector<std::string> GUI::AudioManager::getFiles() const {
+    std::vector<std::string> files;
+
+    for (const auto &[name, path] : _files) {
+        if (std::find(files.begin(), files.end(), path) == files.end())
+            files.push_back(path);
     }
+    return files;
 }
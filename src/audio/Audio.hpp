@@ -2,19 +2,24 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include "../../include/raylib-cpp.hpp"
+#include "../assets/AssetCache.hpp"
 
 namespace GUI {
     class AudioManager {
     public:
-        AudioManager();
-        ~AudioManager() {
-            CloseAudioDevice();
-        };
+        explicit AudioManager(AssetCache &assets);
+        ~AudioManager();
+
+        AudioManager(const AudioManager &) = delete;
+        AudioManager &operator=(const AudioManager &) = delete;
 
         void play(const std::string &name);
+        std::vector<std::string> getFiles() const;
 
     private:
-        std::map<std::string, raylib::Sound> _sounds;
+        AssetCache &_assets;
+        std::map<std::string, std::string> _files;
     };
 } // namespace GUI
@@ -0,0 +1,194 @@
+/**
+ * @file Capture.cpp
+ * @brief Implementation of the protocol capture files for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of CaptureWriter and CaptureReader.
+ * With --record, the network thread stores every chunk returned by
+ * receive_data() together with a monotonic timestamp. With --replay, the
+ * chunks are read back and fed to the same buffer and message queue as the
+ * socket data, so a session can be reproduced without a server.
+ *
+ * Integers are stored little-endian byte by byte, so captures can be
+ * exchanged between machines.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Capture.cpp
+*/
+
+#include "Capture.hpp"
+#include "../log/Logger.hpp"
+#include <cstring>
+
+/**
+ * @brief Destructor of the CaptureWriter class
+ *
+ * Flushes and closes the file if it is still open.
+ */
+GUI::CaptureWriter::~CaptureWriter()
+{
+    close();
+}
+
+/**
+ * @brief Creates the capture file and writes its header
+ *
+ * The file is fully buffered with a FILE_BUFFER_SIZE buffer, so recording
+ * adds a write system call every megabyte rather than every chunk.
+ *
+ * @param path Path of the file to create (truncated if it exists)
+ * @return true if the file was created and the header written
+ */
+bool GUI::CaptureWriter::open(const std::string &path)
+{
+    close();
+    _file = std::fopen(path.c_str(), "wb");
+    if (_file == nullptr) {
+        ZLOG_ERROR(Core, "Cannot create capture file %s", path.c_str());
+        return false;
+    }
+    _file_buffer.resize(FILE_BUFFER_SIZE);
+    std::setvbuf(_file, _file_buffer.data(), _IOFBF, _file_buffer.size());
+
+    if (std::fwrite(MAGIC, 1, sizeof(MAGIC), _file) != sizeof(MAGIC)) {
+        ZLOG_ERROR(Core, "Cannot write capture file %s", path.c_str());
+        close();
+        return false;
+    }
+    _frames = 0;
+    _bytes = 0;
+    return true;
+}
+
+/**
+ * @brief Appends one received chunk to the capture
+ *
+ * @param timestamp Nanoseconds since the capture was opened
+ * @param data Bytes returned by receive_data()
+ * @param size Number of bytes
+ * @return true if the frame was written; on failure the capture is closed
+ */
+bool GUI::CaptureWriter::write_chunk(std::uint64_t timestamp, const char *data, std::size_t size)
+{
+    if (_file == nullptr)
+        return false;
+
+    unsigned char header[12];
+    for (int i = 0; i < 8; i++)
+        header[i] = static_cast<unsigned char>(timestamp >> (8 * i));
+    const auto length = static_cast<std::uint32_t>(size);
+    for (int i = 0; i < 4; i++)
+        header[8 + i] = static_cast<unsigned char>(length >> (8 * i));
+
+    if (std::fwrite(header, 1, sizeof(header), _file) != sizeof(header)
+        || std::fwrite(data, 1, size, _file) != size) {
+        ZLOG_ERROR(Core, "Failed to write capture frame, recording stopped");
+        close();
+        return false;
+    }
+    _frames++;
+    _bytes += size;
+    return true;
+}
+
+/**
+ * @brief Flushes and closes the capture file
+ */
+void GUI::CaptureWriter::close()
+{
+    if (_file == nullptr)
+        return;
+    std::fclose(_file);
+    _file = nullptr;
+    _file_buffer.clear();
+    _file_buffer.shrink_to_fit();
+}
+
+/**
+ * @brief Destructor of the CaptureReader class
+ */
+GUI::CaptureReader::~CaptureReader()
+{
+    close();
+}
+
+/**
+ * @brief Opens a capture file and checks its header
+ *
+ * @param path Path of a file written by CaptureWriter
+ * @return true if the file exists and starts with the capture magic
+ */
+bool GUI::CaptureReader::open(const std::string &path)
+{
+    char magic[sizeof(CaptureWriter::MAGIC)];
+
+    close();
+    _failed = false;
+    _file = std::fopen(path.c_str(), "rb");
+    if (_file == nullptr) {
+        ZLOG_ERROR(Core, "Cannot open capture file %s", path.c_str());
+        return false;
+    }
+    if (std::fread(magic, 1, sizeof(magic), _file) != sizeof(magic)
+        || std::memcmp(magic, CaptureWriter::MAGIC, sizeof(magic)) != 0) {
+        ZLOG_ERROR(Core, "%s is not a capture file", path.c_str());
+        close();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the next frame
+ *
+ * @param frame Receives the frame; its data vector is reused between calls
+ * @return true if a frame was read, false at the end of the file or if the
+ *         file is truncated or corrupted (failed() then returns true)
+ */
+bool GUI::CaptureReader::next_frame(CaptureFrame &frame)
+{
+    unsigned char header[12];
+
+    if (_file == nullptr)
+        return false;
+
+    const std::size_t got = std::fread(header, 1, sizeof(header), _file);
+    if (got != sizeof(header)) {
+        _failed = got != 0;
+        return false;
+    }
+
+    frame.timestamp = 0;
+    for (int i = 0; i < 8; i++)
+        frame.timestamp |= static_cast<std::uint64_t>(header[i]) << (8 * i);
+    std::uint32_t length = 0;
+    for (int i = 0; i < 4; i++)
+        length |= static_cast<std::uint32_t>(header[8 + i]) << (8 * i);
+
+    if (length > MAX_FRAME_SIZE) {
+        _failed = true;
+        return false;
+    }
+    frame.data.resize(length);
+    if (std::fread(frame.data.data(), 1, length, _file) != length) {
+        _failed = true;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Closes the capture file
+ */
+void GUI::CaptureReader::close()
+{
+    if (_file == nullptr)
+        return;
+    std::fclose(_file);
+    _file = nullptr;
+}
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Capture.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief One chunk of bytes received from the server
+     *
+     * timestamp is in nanoseconds since the capture was opened, taken from
+     * the monotonic clock when receive_data() returned.
+     */
+    struct CaptureFrame {
+        std::uint64_t timestamp;
+        std::vector<char> data;
+    };
+
+    /**
+     * @brief Writes received chunks to a capture file
+     *
+     * File layout: the 8-byte magic "ZPCAP001", then one frame per chunk:
+     * a little-endian u64 timestamp in nanoseconds, a little-endian u32
+     * length, and the bytes themselves.
+     */
+    class CaptureWriter {
+        public:
+            static constexpr char MAGIC[8] = {'Z', 'P', 'C', 'A', 'P', '0', '0', '1'};
+            static constexpr std::size_t FILE_BUFFER_SIZE = 1024 * 1024;
+
+            CaptureWriter() = default;
+            ~CaptureWriter();
+
+            CaptureWriter(const CaptureWriter &) = delete;
+            CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+            bool open(const std::string &path);
+            bool write_chunk(std::uint64_t timestamp, const char *data, std::size_t size);
+            void close();
+
+            [[nodiscard]] std::uint64_t frames() const { return _frames; }
+            [[nodiscard]] std::uint64_t bytes() const { return _bytes; }
+
+        private:
+            std::FILE *_file = nullptr;
+            std::vector<char> _file_buffer;
+            std::uint64_t _frames = 0;
+            std::uint64_t _bytes = 0;
+    };
+
+    /**
+     * @brief Reads the frames of a capture file written by CaptureWriter
+     */
+    class CaptureReader {
+        public:
+            static constexpr std::uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
+            CaptureReader() = default;
+            ~CaptureReader();
+
+            CaptureReader(const CaptureReader &) = delete;
+            CaptureReader &operator=(const CaptureReader &) = delete;
+
+            bool open(const std::string &path);
+            bool next_frame(CaptureFrame &frame);
+            void close();
+
+            [[nodiscard]] bool failed() const { return _failed; }
+
+        private:
+            std::FILE *_file = nullptr;
+            bool _failed = false;
+    };
+} // namespace GUI
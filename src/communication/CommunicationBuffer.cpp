@@ -8,8 +8,11 @@
  * manages network communication data buffering. It handles incoming data streams,
  * message parsing, and extraction of complete messages delimited by newline characters.
  *
- * The buffer is designed to handle partial messages and accumulate data until
- * complete messages (terminated by '\n') are available for processing.
+ * The buffer is a single contiguous block with a read cursor, a write cursor and
+ * a scan cursor. Messages are handed out as std::string_view into the block, and
+ * the bytes already searched for a delimiter are never searched again, so draining
+ * a burst of N lines costs O(N) regardless of how they were split by the network.
+ * Consumed bytes are reclaimed by compacting the block when space runs out.
  */
 
 /*
@@ -20,125 +23,159 @@
 */
 
 #include "CommunicationBuffer.hpp"
+#include <cstring>
 
 /**
- * @brief Appends data from a C-style string to the buffer
+ * @brief Constructs a buffer with the given initial capacity
  *
- * Adds the provided C-style string data to the internal input buffer.
- * This method performs null pointer checking to ensure data validity
- * before appending. If the data pointer is null, no operation is performed.
+ * @param capacity Initial size of the contiguous block in bytes
  *
- * This method is typically used when receiving data from network sockets
- * or other C-style string sources.
+ * @note The block grows automatically if a single message does not fit
+ */
+GUI::CommunicationBuffer::CommunicationBuffer(std::size_t capacity)
+    : _data(capacity == 0 ? DEFAULT_CAPACITY : capacity)
+{
+}
+
+/**
+ * @brief Reserves free space at the end of the buffer
  *
- * @param data Pointer to null-terminated C-style string to append
+ * Makes sure at least min_free bytes can be written at the returned address,
+ * typically by recv(). Consumed bytes are first reclaimed by moving the pending
+ * data to the start of the block; the block only grows if that is not enough.
+ * Once data has been written, call commit() with the number of bytes written.
  *
- * @note If data is nullptr, the function safely returns without modification
- * @note The data is appended to the existing buffer content
+ * @param min_free Minimum number of writable bytes required
+ * @return char* Pointer to the first free byte
+ *
+ * @warning Invalidates every std::string_view previously returned by
+ *          extract_next_message() and get_raw_buffer()
  */
-void GUI::CommunicationBuffer::append_data(const char* data)
+char *GUI::CommunicationBuffer::prepare(std::size_t min_free)
 {
-    if (data != nullptr)
-        _input_buffer += data;
+    if (_data.size() - _write >= min_free)
+        return _data.data() + _write;
+
+    if (_read > 0) {
+        const std::size_t pending = _write - _read;
+        std::memmove(_data.data(), _data.data() + _read, pending);
+        _scan -= _read;
+        if (_newline != NPOS)
+            _newline -= _read;
+        _write = pending;
+        _read = 0;
+    }
+
+    if (_data.size() - _write < min_free) {
+        std::size_t capacity = _data.size();
+        while (capacity - _write < min_free)
+            capacity *= 2;
+        _data.resize(capacity);
+    }
+
+    return _data.data() + _write;
 }
 
 /**
- * @brief Appends data from a std::string to the buffer
- *
- * Adds the provided std::string data to the internal input buffer.
- * This method directly appends the string content without additional
- * validation since std::string handles its own memory management.
+ * @brief Returns the number of bytes that can be written without preparing
  *
- * This method is typically used when receiving data from C++ string
- * sources or when converting data formats.
+ * @return size_t Free bytes after the write cursor
+ */
+std::size_t GUI::CommunicationBuffer::writable() const
+{
+    return _data.size() - _write;
+}
+
+/**
+ * @brief Marks bytes written into prepared space as buffer content
  *
- * @param data Reference to std::string containing data to append
+ * @param count Number of bytes written at the address returned by prepare()
  *
- * @note The data is appended to the existing buffer content
- * @note No null checking is required as std::string is passed by reference
+ * @note count must not exceed writable()
  */
-void GUI::CommunicationBuffer::append_data(const std::string& data)
+void GUI::CommunicationBuffer::commit(std::size_t count)
 {
-    _input_buffer += data;
+    _write += count;
 }
 
 /**
- * @brief Checks if the buffer contains at least one complete message
+ * @brief Appends raw bytes to the buffer
  *
- * Determines whether the buffer contains a complete message by searching
- * for the newline character ('\n') which serves as the message delimiter.
- * This method is used to determine if message extraction is possible.
+ * Copies the provided bytes after the pending data. This is the fallback for
+ * sources that cannot write into prepared space directly.
  *
- * @return bool True if at least one complete message is available, false otherwise
+ * @param data Bytes to append, not necessarily null-terminated
  *
- * @note A complete message is defined as any sequence of characters followed by '\n'
- * @note This method does not modify the buffer state
+ * @note The data is appended to the existing buffer content
  */
-bool GUI::CommunicationBuffer::has_complete_message() const
+void GUI::CommunicationBuffer::append_data(std::string_view data)
 {
-    return _input_buffer.find('\n') != std::string::npos;
+    if (data.empty())
+        return;
+
+    std::memcpy(prepare(data.size()), data.data(), data.size());
+    commit(data.size());
 }
 
 /**
- * @brief Extracts the next complete message from the buffer
+ * @brief Checks if the buffer contains at least one complete message
  *
- * Retrieves and removes the next complete message from the buffer.
- * The message is extracted up to (but not including) the first newline
- * character. The newline character and the extracted message are removed
- * from the buffer, leaving any remaining data for subsequent extractions.
+ * Searches for the newline delimiter starting from the scan cursor, so bytes
+ * already searched by a previous call are not searched again. The position of
+ * the delimiter found is remembered for extract_next_message().
  *
- * @return std::string The extracted message without the newline delimiter,
- *                     or an empty string if no complete message is available
+ * @return bool True if at least one complete message is available, false otherwise
  *
- * @note This method modifies the buffer by removing the extracted message
- * @note The newline delimiter is consumed but not included in the return value
- * @note If no complete message exists, returns an empty string and buffer remains unchanged
+ * @note A complete message is defined as any sequence of characters followed by '\n'
+ * @note This method does not modify the buffer content
  */
-std::string GUI::CommunicationBuffer::extract_next_message()
+bool GUI::CommunicationBuffer::has_complete_message() const
 {
-    size_t pos = _input_buffer.find('\n');
-    if (pos == std::string::npos) {
-        return "";
-    }
+    if (_newline != NPOS)
+        return true;
 
-    std::string message = _input_buffer.substr(0, pos);
-    _input_buffer = _input_buffer.substr(pos + 1);
+    const char *start = _data.data() + _scan;
+    const auto *found = static_cast<const char *>(std::memchr(start, '\n', _write - _scan));
+    if (found == nullptr) {
+        _scan = _write;
+        return false;
+    }
 
-    return message;
+    _newline = static_cast<std::size_t>(found - _data.data());
+    _scan = _newline;
+    return true;
 }
 
 /**
- * @brief Extracts all complete messages from the buffer
- *
- * Retrieves and removes all complete messages currently available in the buffer.
- * Each message is extracted sequentially until no more complete messages remain.
- * Empty messages (consecutive newlines) are filtered out and not included
- * in the result vector.
+ * @brief Extracts the next complete message from the buffer
  *
- * This method is useful for batch processing of accumulated messages,
- * particularly when multiple messages have been received in a single
- * network operation.
+ * Returns a view on the next complete message, up to (but not including) the
+ * first newline character, and moves the read cursor past the delimiter.
+ * No memory is allocated or copied.
  *
- * @return std::vector<std::string> Vector containing all extracted messages
- *                                  in the order they appeared in the buffer
+ * @return std::string_view The extracted message without the newline delimiter,
+ *                          or an empty view if no complete message is available
  *
- * @note This method modifies the buffer by removing all extracted messages
- * @note Empty messages are automatically filtered out
- * @note The buffer may still contain incomplete message data after extraction
- * @note Messages are returned in FIFO (First In, First Out) order
+ * @note The view is valid until the next call to prepare(), append_data() or clear()
+ * @note The newline delimiter is consumed but not included in the return value
  */
-std::vector<std::string> GUI::CommunicationBuffer::extract_all_messages()
+std::string_view GUI::CommunicationBuffer::extract_next_message()
 {
-    std::vector<std::string> messages;
+    if (!has_complete_message())
+        return {};
 
-    while (has_complete_message()) {
-        std::string message = extract_next_message();
-        if (!message.empty()) {
-            messages.push_back(message);
-        }
+    std::string_view message(_data.data() + _read, _newline - _read);
+    _read = _newline + 1;
+    _scan = _read;
+    _newline = NPOS;
+
+    if (_read == _write) {
+        _read = 0;
+        _write = 0;
+        _scan = 0;
     }
 
-    return messages;
+    return message;
 }
 
 /**
@@ -150,59 +187,59 @@ std::vector<std::string> GUI::CommunicationBuffer::extract_all_messages()
  *
  * @note After calling this method, the buffer will be empty
  * @note Any incomplete messages in the buffer will be lost
+ * @note The allocated capacity is kept for reuse
  */
 void GUI::CommunicationBuffer::clear()
 {
-    _input_buffer.clear();
+    _read = 0;
+    _write = 0;
+    _scan = 0;
+    _newline = NPOS;
 }
 
 /**
  * @brief Returns the current size of the buffer
  *
- * Provides the number of characters currently stored in the buffer,
+ * Provides the number of characters currently pending in the buffer,
  * including both complete and incomplete message data. This method
  * is useful for monitoring buffer usage and debugging communication issues.
  *
- * @return size_t The number of characters in the buffer
+ * @return size_t The number of pending characters in the buffer
  *
  * @note This includes all data: complete messages, incomplete messages, and delimiters
  * @note The size represents the total character count, not the number of messages
  */
 size_t GUI::CommunicationBuffer::size() const
 {
-    return _input_buffer.size();
+    return _write - _read;
 }
 
 /**
  * @brief Checks if the buffer is empty
  *
- * Determines whether the buffer contains any data. This method is useful
- * for conditional processing and state validation.
+ * Determines whether the buffer contains any pending data. This method is
+ * useful for conditional processing and state validation.
  *
  * @return bool True if the buffer contains no data, false otherwise
  *
- * @note An empty buffer means no data has been appended or all data has been cleared
  * @note This method does not indicate whether complete messages are available
  */
 bool GUI::CommunicationBuffer::empty() const
 {
-    return _input_buffer.empty();
+    return _write == _read;
 }
 
 /**
- * @brief Provides read-only access to the raw buffer content
+ * @brief Provides read-only access to the raw pending content
  *
- * Returns a constant reference to the internal buffer string, allowing
- * inspection of the raw buffer content without modification. This method
- * is useful for debugging, logging, or advanced buffer analysis.
+ * Returns a view on the bytes that have been appended but not yet extracted.
+ * This method is useful for debugging, logging, or advanced buffer analysis.
  *
- * @return const std::string& Constant reference to the internal buffer
+ * @return std::string_view View on the pending bytes
  *
- * @warning This method exposes the internal buffer state and should be used carefully
- * @note The returned reference is valid only as long as the buffer object exists
- * @note Any buffer modifications will affect the content accessible through this reference
+ * @note The view is valid until the next call to prepare(), append_data() or clear()
  */
-const std::string &GUI::CommunicationBuffer::get_raw_buffer() const
+std::string_view GUI::CommunicationBuffer::get_raw_buffer() const
 {
-    return _input_buffer;
+    return {_data.data() + _read, _write - _read};
 }
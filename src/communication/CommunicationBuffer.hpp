@@ -7,34 +7,45 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace GUI {
 
 class CommunicationBuffer {
     public:
-        CommunicationBuffer() = default;
+        static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+        static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+        explicit CommunicationBuffer(std::size_t capacity = DEFAULT_CAPACITY);
         ~CommunicationBuffer() = default;
-        
+
         CommunicationBuffer(const CommunicationBuffer&) = delete;
         CommunicationBuffer &operator=(const CommunicationBuffer&) = delete;
-        
-        void append_data(const char* data);
-        void append_data(const std::string& data);
+
+        char *prepare(std::size_t min_free);
+        [[nodiscard]] std::size_t writable() const;
+        void commit(std::size_t count);
+
+        void append_data(std::string_view data);
         bool has_complete_message() const;
-        std::string extract_next_message();
-        std::vector<std::string> extract_all_messages();
-        
+        std::string_view extract_next_message();
+
         void clear();
-        
+
         [[nodiscard]] size_t size() const;
-        
+
         [[nodiscard]] bool empty() const;
-        [[nodiscard]] const std::string &get_raw_buffer() const;
+        [[nodiscard]] std::string_view get_raw_buffer() const;
 
     private:
-        std::string _input_buffer;
+        std::vector<char> _data;
+        std::size_t _read = 0;
+        std::size_t _write = 0;
+        mutable std::size_t _scan = 0;
+        mutable std::size_t _newline = NPOS;
     };
 
 } // namespace GUI
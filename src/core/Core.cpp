@@ -16,43 +16,130 @@
 */
 
 #include "Core.hpp"
-#include "../communication/CommunicationBuffer.hpp"
 #include "../network/NetworkManager.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <raylib.h>
-#include <sstream>
+#include <type_traits>
 #include "../map/Map.hpp"
+#include "../log/Logger.hpp"
+#include "../memory/AllocationCounter.hpp"
+
+namespace {
+
+    /**
+     * @brief Drops the cached models when it goes out of scope
+     *
+     * Declared right after the window in run(), so the models are freed
+     * before the window (and its GL context) is closed, even when run()
+     * leaves through an exception.
+     */
+    struct ModelRelease {
+        GUI::AssetCache &assets;
+
+        ~ModelRelease() { assets.clearModels(); }
+    };
+} // namespace
+
+/**
+ * @brief Parses a strictly positive integer command line value
+ * @param option Name of the option, used in error messages
+ * @param value Text to parse
+ * @return The parsed value
+ *
+ * @throw CoreError If the value is not a number, out of range or not positive
+ */
+static long parse_positive(const std::string &option, const char *value)
+{
+    long result = 0;
+
+    try {
+        result = std::stol(value);
+    } catch (const std::invalid_argument &) {
+        throw GUI::Core::CoreError("Invalid " + option + ": not a number");
+    } catch (const std::out_of_range &) {
+        throw GUI::Core::CoreError("Invalid " + option + ": number out of range");
+    }
+    if (result <= 0)
+        throw GUI::Core::CoreError("Invalid " + option + ": must be positive");
+    return result;
+}
 
 /**
  * @brief Constructor of the Core class
  * @param argv Array of command line arguments
  *
- * Initializes the Core with connection parameters (-p for port, -h for hostname).
- * Creates network, communication and clock managers.
+ * Initializes the Core with connection parameters (-p for port, -h for hostname),
+ * the optional ingest budget (--ingest-bytes for the maximum number of bytes,
+ * --ingest-ms for the maximum time in milliseconds spent ingesting per step) and
+ * the logging options (--debug, --log-level <level>, --log-categories <list>) and
+ * the capture options (--record <file>, or --replay <file> with --speed <n>).
+ * -p and -h are not needed when replaying a capture.
+ * Creates the clock manager; the network thread is created once connected.
  *
- * @throw CoreError If -p or -h arguments are missing or invalid
+ * @throw CoreError If -p or -h arguments are missing or invalid, if a
+ *        logging option names an unknown level or category, or if the
+ *        capture options are invalid
  */
-GUI::Core::Core(char **argv) : _port(0), _timeUnit(0), _connected(false), _server_fd(-1), _showInfoOverlay(false)
+GUI::Core::Core(char **argv) : _port(0), _replay_speed(1.0), _timeUnit(0), _showInfoOverlay(false),
+    _frameAllocations(0), _firstFrameMs(-1.0), _assetsLoadedMs(-1.0), _events(EVENT_CAPACITY), _ingest_running(false), _ingest_finished(false), _audio(_assets)
 {
-    _network_manager = std::make_unique<NetworkManager>();
-    _comm_buffer = std::make_unique<CommunicationBuffer>();
     _clock = std::make_unique<Clock>();
 
-    for (int i = 1; i <= 3; ++i) {
+    for (int i = 1; argv[i] != nullptr; i++) {
         std::string arg = argv[i];
+        if (arg == "--debug") {
+            Logger::instance().setLevel(LogLevel::Debug);
+            continue;
+        }
+        if (argv[i + 1] == nullptr)
+            break;
+        const char *value = argv[++i];
+
         if (arg == "-p") {
             try {
-                _port = std::stoi(argv[i + 1]);
+                _port = std::stoi(value);
             } catch (const std::invalid_argument &) {
                 throw CoreError("Invalid port: not a number");
             } catch (const std::out_of_range &) {
                 throw CoreError("Invalid port: number out of range");
             }
         } else if (arg == "-h") {
-            _hostname = argv[i + 1];
+            _hostname = value;
+        } else if (arg == "--ingest-bytes") {
+            _ingest_budget.max_bytes = static_cast<std::size_t>(parse_positive(arg, value));
+        } else if (arg == "--ingest-ms") {
+            _ingest_budget.max_time = std::chrono::milliseconds(parse_positive(arg, value));
+        } else if (arg == "--record") {
+            _record_path = value;
+        } else if (arg == "--replay") {
+            _replay_path = value;
+        } else if (arg == "--speed") {
+            char *end = nullptr;
+            _replay_speed = std::strtod(value, &end);
+            if (end == value || *end != '\0' || _replay_speed < 0.0)
+                throw CoreError("Invalid --speed: expected a non-negative number");
+        } else if (arg == "--log-level") {
+            LogLevel level = LogLevel::Info;
+            if (!Logger::parseLevel(value, level))
+                throw CoreError("Invalid --log-level: expected trace, debug, info, warning, error or off");
+            Logger::instance().setLevel(level);
+        } else if (arg == "--log-categories") {
+            std::uint32_t mask = 0;
+            if (!Logger::parseCategories(value, mask))
+                throw CoreError("Invalid --log-categories: expected a comma separated list of "
+                    "core, network, protocol, render, audio or all");
+            Logger::instance().setCategories(mask);
         }
     }
 
+    if (!_replay_path.empty()) {
+        if (!_record_path.empty())
+            throw CoreError("--record and --replay cannot be used together");
+        return;
+    }
     if (_port == 0 || _hostname.empty())
         throw CoreError("Missing -p or -h argument");
 }
@@ -60,36 +147,58 @@ GUI::Core::Core(char **argv) : _port(0), _timeUnit(0), _connected(false), _serve
 /**
  * @brief Destructor of the Core class
  *
- * Cleans up resources used by the Core.
+ * Cleans up resources used by the Core. The ingest thread is joined first,
+ * as it uses the network thread; the network thread, if any, is then
+ * stopped and joined before the connection is closed.
  */
 GUI::Core::~Core()
 {
+    stop_ingest();
 }
 
 /**
  * @brief Establishes connection to the Zappy server
  * @return true if connection and authentication succeed, false otherwise
  *
- * Uses the NetworkManager to create a connection to the specified server
- * and performs the required authentication.
+ * Uses a NetworkManager to create a connection to the specified server
+ * and performs the required authentication, then hands the manager over to
+ * the network thread which owns it from then on. With --record, the network
+ * thread also stores everything it receives to the capture file.
+ *
+ * With --replay, no connection is made: the network thread reads the capture
+ * file instead of a socket.
  */
 bool GUI::Core::connect_to_server()
 {
-    if (!_network_manager->create_and_connect(_hostname, _port))
+    if (!_replay_path.empty()) {
+        auto reader = std::make_unique<CaptureReader>();
+        if (!reader->open(_replay_path))
+            return false;
+        _network_thread = std::make_unique<NetworkThread>(std::move(reader), _replay_speed, _ingest_budget);
+        _network_thread->start();
+        return true;
+    }
+
+    auto manager = std::make_unique<NetworkManager>();
+
+    if (!manager->create_and_connect(_hostname, _port))
         return false;
 
-    if (!_network_manager->authenticate())
+    if (!manager->authenticate())
         return false;
 
-    _connected = true;
+    _network_thread = std::make_unique<NetworkThread>(std::move(manager), _ingest_budget);
+    if (!_record_path.empty() && !_network_thread->record_to(_record_path))
+        return false;
+    _network_thread->start();
     return true;
 }
 
 /**
  * @brief Processes messages received from the server
- * @param message Message received from the server to process
+ * @param message Message received from the server, parsed by Protocol::parse()
  *
- * Parses and processes all types of messages from the Zappy protocol:
+ * Applies all types of messages from the Zappy protocol:
  * - msz : Map size
  * - bct : Tile content
  * - tna : Team name
@@ -113,221 +222,326 @@ bool GUI::Core::connect_to_server()
  * - smg : Server message
  * - suc : Unknown command
  * - sbp : Bad parameters
+ *
+ * The message type is resolved once by std::visit; each branch below is
+ * selected at compile time.
+ *
+ * @note Runs on the ingest thread: it only touches the World and the
+ *       refresh scheduler, and hands sounds and on-screen messages to the
+ *       render thread with post_event().
+ */
+void GUI::Core::handle_server_message(const Protocol::Message &message)
+{
+    std::visit([this](const auto &m) {
+        using T = std::decay_t<decltype(m)>;
+
+        if constexpr (std::is_same_v<T, Protocol::MapSize>) {
+            _world.resize(m.width, m.height);
+            _scheduler.setMapSize(m.width, m.height);
+            ZLOG_INFO(Protocol, "Map size: %dx%d", m.width, m.height);
+        } else if constexpr (std::is_same_v<T, Protocol::TileContent>) {
+            const auto &q = m.resources;
+            if (!_world.setTile(m.x, m.y, q)) {
+                ZLOG_WARNING(Protocol, "Tile (%d,%d) is outside the %dx%d map", m.x, m.y, _world.getWidth(), _world.getHeight());
+                return;
+            }
+            _scheduler.markTileFresh(m.x, m.y);
+
+            ZLOG_DEBUG(Protocol, "Tile (%d,%d) resources: %d %d %d %d %d %d %d",
+                      m.x, m.y, q[0], q[1], q[2], q[3], q[4], q[5], q[6]);
+        } else if constexpr (std::is_same_v<T, Protocol::TeamName>) {
+            _world.registerTeam(m.name);
+            ZLOG_INFO(Protocol, "Team: %.*s", (int)m.name.size(), m.name.data());
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerNew>) {
+            post_event(IngestEvent::Kind::Sound, "newPlayer");
+            const TeamRegistry::Index team = _world.registerTeam(m.team);
+            if (!_world.addPlayer(m.id, m.x, m.y, team, m.orientation, m.level)) {
+                ZLOG_WARNING(Protocol, "pnw: player id #%d out of range, ignored", m.id);
+                return;
+            }
+            _scheduler.addPlayer(m.id);
+            ZLOG_DEBUG(Protocol, "Player #%d connected at (%d,%d) team: %.*s",
+                      m.id, m.x, m.y, (int)m.team.size(), m.team.data());
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerPosition>) {
+            _world.movePlayer(m.id, m.x, m.y, m.orientation);
+            _scheduler.markPlayerFresh(QueryKind::Position, m.id);
+
+            ZLOG_DEBUG(Protocol, "Player #%d position: (%d,%d) orientation: %d",
+                      m.id, m.x, m.y, m.orientation);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerLevel>) {
+            _world.setPlayerLevel(m.id, m.level);
+            _scheduler.markPlayerFresh(QueryKind::Level, m.id);
+
+            ZLOG_DEBUG(Protocol, "Player #%d level: %d", m.id, m.level);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerInventory>) {
+            const auto &q = m.resources;
+            _world.setPlayerInventory(m.id, q);
+            _scheduler.markPlayerFresh(QueryKind::Inventory, m.id);
+
+            ZLOG_DEBUG(Protocol, "Player #%d inventory at (%d,%d): %d %d %d %d %d %d %d",
+                      m.id, m.x, m.y, q[0], q[1], q[2], q[3], q[4], q[5], q[6]);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerExpulsion>) {
+            post_event(IngestEvent::Kind::Sound, "playerExpulsion");
+            ZLOG_DEBUG(Protocol, "Player #%d expelled", m.id);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerBroadcast>) {
+            post_event(IngestEvent::Kind::Sound, "broadcast");
+            _world.setPlayerBroadcast(m.id, m.message);
+        } else if constexpr (std::is_same_v<T, Protocol::IncantationStart>) {
+            post_event(IngestEvent::Kind::Sound, "incantationStart");
+            std::string_view players = m.players;
+            int id = 0;
+            while (Protocol::next_id(players, id))
+                if (!_world.setPlayerIncanting(id, true))
+                    ZLOG_WARNING(Protocol, "pic: unknown player #%d", id);
+            ZLOG_DEBUG(Protocol, "Incantation started at (%d,%d) level %d players: %.*s",
+                      m.x, m.y, m.level, (int)m.players.size(), m.players.data());
+        } else if constexpr (std::is_same_v<T, Protocol::IncantationEnd>) {
+            post_event(IngestEvent::Kind::Sound, "incantationEnd");
+            const std::size_t players = _world.endIncantation(m.x, m.y);
+            ZLOG_DEBUG(Protocol, "Incantation ended at (%d,%d) result: %s, %zu players released",
+                      m.x, m.y, m.result != 0 ? "success" : "failure", players);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerFork>) {
+            ZLOG_DEBUG(Protocol, "Player #%d laid an egg", m.id);
+        } else if constexpr (std::is_same_v<T, Protocol::ResourceDrop>) {
+            if (!_world.dropResource(m.id, m.resource))
+                ZLOG_WARNING(Protocol, "pdr: unknown player #%d or resource %d", m.id, m.resource);
+            ZLOG_DEBUG(Protocol, "Player #%d dropped resource %d", m.id, m.resource);
+        } else if constexpr (std::is_same_v<T, Protocol::ResourceCollect>) {
+            if (!_world.collectResource(m.id, m.resource))
+                ZLOG_WARNING(Protocol, "pgt: unknown player #%d or resource %d", m.id, m.resource);
+            ZLOG_DEBUG(Protocol, "Player #%d collected resource %d", m.id, m.resource);
+        } else if constexpr (std::is_same_v<T, Protocol::PlayerDeath>) {
+            post_event(IngestEvent::Kind::PlayerDeath, "deathPlayer", m.id);
+            if (!_world.removePlayer(m.id))
+                ZLOG_WARNING(Protocol, "pdi: unknown or already dead player #%d", m.id);
+            _scheduler.removePlayer(m.id);
+        } else if constexpr (std::is_same_v<T, Protocol::EggNew>) {
+            EggInfo egg;
+            egg.id = m.egg;
+            egg.player_id = m.player;
+            egg.x = m.x;
+            egg.y = m.y;
+            if (!_world.addEgg(egg))
+                ZLOG_WARNING(Protocol, "enw: egg id #%d out of range, ignored", m.egg);
+
+            ZLOG_DEBUG(Protocol, "New egg #%d laid by #%d at (%d,%d)", m.egg, m.player, m.x, m.y);
+        } else if constexpr (std::is_same_v<T, Protocol::EggHatch>) {
+            if (!_world.removeEgg(m.egg))
+                ZLOG_WARNING(Protocol, "ebo: unknown or already removed egg #%d", m.egg);
+            ZLOG_DEBUG(Protocol, "Egg #%d hatched", m.egg);
+        } else if constexpr (std::is_same_v<T, Protocol::EggDeath>) {
+            if (!_world.removeEgg(m.egg))
+                ZLOG_WARNING(Protocol, "edi: unknown or already removed egg #%d", m.egg);
+            ZLOG_DEBUG(Protocol, "Egg #%d died", m.egg);
+        } else if constexpr (std::is_same_v<T, Protocol::TimeUnit>) {
+            _timeUnit = m.frequency;
+            post_event(IngestEvent::Kind::TimeUnit, nullptr, m.frequency);
+            _scheduler.setTimeUnit(m.frequency);
+            ZLOG_INFO(Protocol, "Time unit: %d", m.frequency);
+        } else if constexpr (std::is_same_v<T, Protocol::GameEnd>) {
+            post_event(IngestEvent::Kind::GameEnd, "endGame", 0, m.team);
+            ZLOG_INFO(Protocol, "Game ended, winner: %.*s", (int)m.team.size(), m.team.data());
+        } else if constexpr (std::is_same_v<T, Protocol::ServerText>) {
+            ZLOG_INFO(Protocol, "Server message: %.*s", (int)m.text.size(), m.text.data());
+        } else if constexpr (std::is_same_v<T, Protocol::UnknownCommand>) {
+            ZLOG_WARNING(Protocol, "Unknown command sent to server");
+        } else if constexpr (std::is_same_v<T, Protocol::BadParameters>) {
+            ZLOG_WARNING(Protocol, "Bad parameters sent to server");
+        } else {
+            ZLOG_WARNING(Protocol, "Unknown message from server: %.*s", (int)m.line.size(), m.line.data());
+        }
+    }, message);
+}
+
+/**
+ * @brief Hands an event over to the render thread
+ * @param kind What happened
+ * @param sound Sound to play, or nullptr
+ * @param value Player number or frequency, depending on @p kind
+ * @param text Winning team for GameEnd
+ *
+ * The text is copied into the queue slot, which keeps its capacity for the
+ * next event. Events are cosmetic: if the render thread falls so far behind that the
+ * queue is full, the event is dropped and logged.
  */
-void GUI::Core::handle_server_message(const std::string &message)
+void GUI::Core::post_event(IngestEvent::Kind kind, const char *sound, int value, std::string_view text)
 {
-    if (message.empty())
+    IngestEvent *event = _events.acquire();
+    if (event == nullptr) {
+        ZLOG_WARNING(Core, "Event queue full, event dropped");
         return;
+    }
+    event->kind = kind;
+    event->sound = sound;
+    event->value = value;
+    event->text.assign(text);
+    _events.publish();
+}
 
-    std::istringstream iss(message);
-    std::string command;
-    iss >> command;
-
-    std::cout << "Received: " << message << std::endl;
-
-    if (command == "msz") {
-        int width;
-        int height;
-        iss >> width >> height;
-        _mapInfo.width = width;
-        _mapInfo.height = height;
-        std::cout << "Map size: " << width << "x" << height << std::endl;
-
-    } else if (command == "bct") {
-        int x;
-        int y;
-        int q0;
-        int q1;
-        int q2;
-        int q3;
-        int q4;
-        int q5;
-        int q6;
-        iss >> x >> y >> q0 >> q1 >> q2 >> q3 >> q4 >> q5 >> q6;
-
-        TileInfo tile;
-        tile.x = x;
-        tile.y = y;
-        tile.resources = {q0, q1, q2, q3, q4, q5, q6};
-        _mapInfo.tiles[{x, y}] = tile;
-
-        std::cout << "Tile (" << x << "," << y << ") resources: "
-                  << q0 << " " << q1 << " " << q2 << " " << q3 << " "
-                  << q4 << " " << q5 << " " << q6 << std::endl;
-    } else if (command == "tna") {
-        std::string team_name;
-        iss >> team_name;
-        _gameInfo.teams.push_back(team_name);
-        std::cout << "Team: " << team_name << std::endl;
-    } else if (command == "pnw") {
-        std::string player_id_str;
-        std::string team_name;
-        int x;
-        int y;
-        int orientation;
-        int level;
-        iss >> player_id_str >> x >> y >> orientation >> level >> team_name;
-
-        _audio.play("newPlayer");
-        GUI::Player player(x, y, player_id_str, team_name, orientation, level);
-        _gameInfo.players[player_id_str] = player;
-        std::cout << "Player " << player_id_str << " connected at ("
-                  << x << "," << y << ") team: " << team_name << std::endl;
-    } else if (command == "ppo") {
-        std::string player_id_str;
-        int x;
-        int y;
-        int orientation;
-        iss >> player_id_str >> x >> y >> orientation;
-
-        if (_gameInfo.players.find(player_id_str) != _gameInfo.players.end()) {
-            _gameInfo.players[player_id_str].addMove(x - _gameInfo.players[player_id_str].getX(), y - _gameInfo.players[player_id_str].getY());
-            _gameInfo.players[player_id_str].setPosition(x, y);
-            _gameInfo.players[player_id_str].setOrientation(orientation);
+/**
+ * @brief Applies the events posted by the ingest thread
+ *
+ * Plays their sounds and updates the on-screen messages and game
+ * information. Runs on the render thread, once per frame.
+ */
+void GUI::Core::apply_events()
+{
+    for (IngestEvent *event = _events.front(); event != nullptr; event = _events.front()) {
+        if (event->sound != nullptr)
+            _audio.play(event->sound);
+
+        switch (event->kind) {
+            case IngestEvent::Kind::PlayerDeath: {
+                DeathMessage msg;
+                msg.text = TextFormat("Player #%d died", event->value);
+                msg.timestamp = GetTime();
+                _deathMessages.push_back(msg);
+                break;
+            }
+            case IngestEvent::Kind::TimeUnit:
+                _gameInfo.timeUnit = event->value;
+                _clock->setTimeUnit(event->value);
+                break;
+            case IngestEvent::Kind::GameEnd:
+                _gameInfo.winner = event->text;
+                break;
+            default:
+                break;
         }
+        _events.pop();
+    }
+}
 
-        std::cout << "Player " << player_id_str << " position: ("
-                  << x << "," << y << ") orientation: " << orientation << std::endl;
-    } else if (command == "plv") {
-        std::string player_id_str;
-        int level;
-        iss >> player_id_str >> level;
+/**
+ * @brief Starts the ingest thread
+ * @param replaying true if the network thread replays a capture file
+ *
+ * From then on the ingest thread is the only one to drain server messages,
+ * modify the World, run the refresh scheduler and send commands.
+ */
+void GUI::Core::start_ingest(bool replaying)
+{
+    _ingest_finished = false;
+    _ingest_running = true;
+    _ingest_thread = std::thread(&Core::ingest_loop, this, replaying);
+}
 
-        if (_gameInfo.players.find(player_id_str) != _gameInfo.players.end()) {
-            _gameInfo.players[player_id_str].setLevel(level);
-        }
+/**
+ * @brief Stops the ingest thread and waits for it
+ */
+void GUI::Core::stop_ingest()
+{
+    _ingest_running = false;
+    if (_ingest_thread.joinable())
+        _ingest_thread.join();
+}
+
+/**
+ * @brief Copies the counters shown by the overlay
+ * @param steps Heap allocations of the ingest steps since the last report
+ * @param publishes Heap allocations of the publishes since the last report
+ *
+ * NetworkThread::get_stats() and the scheduler rates may only be read on
+ * the ingest thread, so they are copied under a lock for the render thread.
+ */
+void GUI::Core::publish_report(const AllocationTally &steps, const AllocationTally &publishes)
+{
+    IngestReport report;
+
+    report.network = _network_thread->get_stats();
+    for (std::size_t kind = 0; kind < RefreshScheduler::KIND_COUNT; kind++)
+        report.queryRates[kind] = _scheduler.getAchievedRate(static_cast<QueryKind>(kind));
+    report.stepAllocations = steps.average();
+    report.publishAllocations = publishes.average();
+
+    std::lock_guard<std::mutex> lock(_report_mutex);
+    _report = report;
+}
 
-        std::cout << "Player " << player_id_str << " level: " << level << std::endl;
-    } else if (command == "pin") {
-        std::string player_id_str;
-        int x;
-        int y;
-        int q0;
-        int q1;
-        int q2;
-        int q3;
-        int q4;
-        int q5;
-        int q6;
-        iss >> player_id_str >> x >> y >> q0 >> q1 >> q2 >> q3 >> q4 >> q5 >> q6;
-
-        if (_gameInfo.players.find(player_id_str) != _gameInfo.players.end()) {
-            _gameInfo.players[player_id_str].setInventory({q0, q1, q2, q3, q4, q5, q6});
+/**
+ * @brief Main loop of the ingest thread
+ * @param replaying true if the network thread replays a capture file (no
+ *        queries are sent then)
+ *
+ * Sends the periodic queries, then parses and applies the queued server
+ * messages to the World within the ingest budget, and flushes the commands.
+ * A snapshot of the World is published once the queue is drained; under a
+ * sustained backlog one is still published every MAX_PUBLISH_DELAY so the
+ * display keeps moving. Draining the queue says nothing about the server
+ * having sent everything, so the content of a new map is fenced separately:
+ * after msz, nothing is published until every tile was received (see
+ * World::isAwaitingTiles()), whatever the delay. The fence is only released
+ * early if no tile arrived for MAP_FENCE_STALL (the server never answers
+ * some of them) or once the connection is gone.
+ *
+ * Heap allocations are counted separately for the steps themselves, which
+ * reuse their buffers and should not allocate once the game is running, and
+ * for the publishes, which allocate the chunks and pages that changed.
+ *
+ * The loop ends when stop_ingest() is called, or once the connection is
+ * gone and every message was applied.
+ */
+void GUI::Core::ingest_loop(bool replaying)
+{
+    static constexpr std::size_t NO_FENCE = static_cast<std::size_t>(-1);
+
+    auto lastPublish = std::chrono::steady_clock::now();
+    auto lastReport = lastPublish;
+    auto fenceProgress = lastPublish;
+    std::size_t fenceKnown = NO_FENCE;
+    AllocationTally steps;
+    AllocationTally publishes;
+
+    while (_ingest_running) {
+        const std::uint64_t stepStart = AllocationCounter::count();
+        if (!replaying && !_network_thread->is_congested()) {
+            _queries.clear();
+            _scheduler.collect(_queries);
+            for (const auto &query : _queries)
+                send_query(query);
         }
 
-        std::cout << "Player " << player_id_str << " inventory at ("
-                  << x << "," << y << "): " << q0 << " " << q1 << " " << q2
-                  << " " << q3 << " " << q4 << " " << q5 << " " << q6 << std::endl;
-    } else if (command == "pex") {
-        _audio.play("playerExpulsion");
-        std::string player_id_str;
-        iss >> player_id_str;
-        std::cout << "Player " << player_id_str << " expelled" << std::endl;
-    } else if (command == "pbc") {
-        _audio.play("broadcast");
-        std::string idStr;
-        std::string msg;
-
-        iss >> idStr;
-        std::getline(iss, msg);
-        if (!msg.empty() && msg[0] == ' ')
-            msg.erase(0, 1);
-        auto it = _gameInfo.players.find(idStr);
-        if (it != _gameInfo.players.end())
-            it->second.setBroadcastMessage(msg);
-    } else if (command == "pic") {
-        _audio.play("incantationStart");
-        int x;
-        int y;
-        int level;
-        iss >> x >> y >> level;
-        std::cout << "Incantation started at (" << x << "," << y << ") level " << level;
-        std::string player_id_str;
-        while (iss >> player_id_str) {
-            if (player_id_str[0] == '#')
-                std::cout << " player " << player_id_str;
+        const std::size_t count = _network_thread->drain_messages([this](const std::string &line) {
+            ZLOG_TRACE(Protocol, "Received: %s", line.c_str());
+            handle_server_message(Protocol::parse(line));
+        }, _ingest_budget);
+        _network_thread->flush_commands();
+        if (count > 0)
+            steps.add(AllocationCounter::count() - stepStart);
+
+        const auto now = std::chrono::steady_clock::now();
+        const bool backlog = _network_thread->has_pending_messages();
+        const bool finished = !backlog && !_network_thread->is_connected();
+        if (!_world.isAwaitingTiles()) {
+            fenceKnown = NO_FENCE;
+        } else if (_world.getTiles().getKnownCount() != fenceKnown) {
+            fenceKnown = _world.getTiles().getKnownCount();
+            fenceProgress = now;
+        }
+        if (_world.isAwaitingTiles() && (finished || now - fenceProgress >= MAP_FENCE_STALL)) {
+            ZLOG_WARNING(Protocol, "Map content stopped at %zu / %zu tiles, publishing it incomplete",
+                         fenceKnown, _world.getTiles().size());
+            _world.releaseTileFence();
+        }
+        if (_world.hasUnpublishedChanges() && !_world.isAwaitingTiles()
+            && (!backlog || finished || now - lastPublish >= MAX_PUBLISH_DELAY)) {
+            const std::uint64_t publishStart = AllocationCounter::count();
+            _snapshots.store(_world.publish());
+            publishes.add(AllocationCounter::count() - publishStart);
+            lastPublish = now;
         }
-        std::cout << std::endl;
-    } else if (command == "pie") {
-        _audio.play("incantationEnd");
-        int x;
-        int y;
-        int result;
-        iss >> x >> y >> result;
-        std::cout << "Incantation ended at (" << x << "," << y << ") result: "
-                  << (result != 0 ? "success" : "failure") << std::endl;
-    } else if (command == "pfk") {
-        std::string player_id_str;
-        iss >> player_id_str;
-        std::cout << "Player " << player_id_str << " laid an egg" << std::endl;
-    } else if (command == "pdr") {
-        std::string player_id_str;
-        int resource;
-        iss >> player_id_str >> resource;
-        std::cout << "Player " << player_id_str << " dropped resource " << resource << std::endl;
-    } else if (command == "pgt") {
-        std::string player_id_str;
-        int resource;
-        iss >> player_id_str >> resource;
-        std::cout << "Player " << player_id_str << " collected resource " << resource << std::endl;
-    } else if (command == "pdi") {
-        _audio.play("deathPlayer");
-        std::string player_id_str;
-        iss >> player_id_str;
-        DeathMessage msg;
-        msg.text = TextFormat("Player %s died", player_id_str.c_str());
-        msg.timestamp = GetTime();
-        _deathMessages.push_back(msg);
-        _gameInfo.players.erase(player_id_str);
-    } else if (command == "enw") {
-        std::string egg_id_str;
-        std::string player_id_str;
-        int x;
-        int y;
-        iss >> egg_id_str >> player_id_str >> x >> y;
-
-        EggInfo egg;
-        egg.id = egg_id_str;
-        egg.player_id = player_id_str;
-        egg.x = x;
-        egg.y = y;
-        _gameInfo.eggs[egg_id_str] = egg;
-
-        std::cout << "New egg " << egg_id_str << " laid by " << player_id_str
-                  << " at (" << x << "," << y << ")" << std::endl;
-    } else if (command == "ebo") {
-        std::string egg_id_str;
-        iss >> egg_id_str;
-        _gameInfo.eggs.erase(egg_id_str);
-        std::cout << "Egg " << egg_id_str << " hatched" << std::endl;
-    } else if (command == "edi") {
-        std::string egg_id_str;
-        iss >> egg_id_str;
-        _gameInfo.eggs.erase(egg_id_str);
-        std::cout << "Egg " << egg_id_str << " died" << std::endl;
-    } else if (command == "sgt") {
-        int time_unit;
-        iss >> time_unit;
-        _timeUnit = time_unit;
-        _gameInfo.timeUnit = time_unit;
-        _clock->setTimeUnit(time_unit);
-        std::cout << "Time unit: " << time_unit << std::endl;
-    } else if (command == "seg") {
-        _audio.play("endGame");
-        std::string team_name;
-        iss >> team_name;
-        _gameInfo.winner = team_name;
-        std::cout << "Game ended, winner: " << team_name << std::endl;
-    } else if (command == "smg") {
-        std::string server_message;
-        std::getline(iss, server_message);
-        std::cout << "Server message:" << server_message << std::endl;
-    } else if (command == "suc") {
-        std::cout << "Unknown command sent to server" << std::endl;
-    } else if (command == "sbp") {
-        std::cout << "Bad parameters sent to server" << std::endl;
-    } else {
-        std::cout << "Unknown message from server: " << message << std::endl;
+        if (now - lastReport >= REPORT_INTERVAL || finished) {
+            publish_report(steps, publishes);
+            steps = AllocationTally{};
+            publishes = AllocationTally{};
+            lastReport = now;
+        }
+        if (finished) {
+            _ingest_finished = true;
+            return;
+        }
+        if (count == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 }
 
@@ -335,22 +549,32 @@ void GUI::Core::handle_server_message(const std::string &message)
  * @brief Displays the game information overlay
  *
  * Draws a user interface overlay containing:
- * - Map information (size, number of tiles)
- * - Game information (time unit, teams, players, eggs)
- * - Teams list
- * - Players list (limited to 10 for display)
+ * - Map information (size, number of tiles), the draw calls of the map,
+ *   how many tile chunks were visible or culled and how many resources,
+ *   eggs and players were drawn at each detail level, and the number of
+ *   asset files read so far
+ * - Game information (time unit, teams, players, eggs), resource totals on
+ *   the map and the level distribution
+ * - Teams with their player and egg counts and best level
+ * - Network queue depths, drop counters and how far behind the server the client is
+ * - Query rates achieved by the refresh scheduler
+ * - Heap allocations of the last frame, and per ingest step and publish
+ * - Players list (at most 10, fewer if they do not fit)
  * - Game winner if any
  *
  * The overlay is displayed only if _showInfoOverlay is true.
+ *
+ * @param snapshot Snapshot rendered this frame, or nullptr before the first one
+ * @param render Draw calls and culling of the map this frame, or nullptr if it was not drawn
  */
-void GUI::Core::drawInfoOverlay()
+void GUI::Core::drawInfoOverlay(const WorldSnapshot *snapshot, const RenderStats *render)
 {
-    if (!_showInfoOverlay) return;
+    if (!_showInfoOverlay || snapshot == nullptr) return;
 
     const int screenWidth = 1280;
     const int screenHeight = 720;
     const int overlayWidth = 400;
-    const int overlayHeight = 600;
+    const int overlayHeight = 700;
     const int overlayX = screenWidth - overlayWidth - 20;
     const int overlayY = 20;
 
@@ -365,20 +589,69 @@ void GUI::Core::drawInfoOverlay()
 
     DrawText("MAP INFO:", overlayX + 10, yOffset, 16, WHITE);
     yOffset += lineHeight;
-    DrawText(TextFormat("Size: %dx%d", _mapInfo.width, _mapInfo.height), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    DrawText(TextFormat("Size: %dx%d", snapshot->getWidth(), snapshot->getHeight()), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    yOffset += lineHeight;
+    DrawText(TextFormat("Tiles: %d / %d (%d chunks, %d KB)", (int)snapshot->getKnownCount(), (int)snapshot->getTileCount(),
+             (int)snapshot->getChunkCount(), (int)(snapshot->getMemoryUsage() / 1024)), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    yOffset += lineHeight;
+    DrawText(TextFormat("Asset files loaded: %d", (int)_assets.getLoadCount()), overlayX + 20, yOffset, 12, LIGHTGRAY);
+    yOffset += lineHeight;
+    if (_assetsLoadedMs < 0.0)
+        DrawText(TextFormat("Startup: first frame %d ms, assets loading", (int)_firstFrameMs), overlayX + 20, yOffset, 12, ORANGE);
+    else
+        DrawText(TextFormat("Startup: first frame %d ms, assets %d ms", (int)_firstFrameMs, (int)_assetsLoadedMs), overlayX + 20, yOffset, 12, LIGHTGRAY);
+    yOffset += lineHeight;
+    if (render != nullptr) {
+        DrawText(TextFormat("Draw calls: %d (ground %d, resources %d, eggs %d, players %d)",
+                 (int)render->total(), (int)render->ground, (int)render->resources,
+                 (int)render->eggs, (int)render->players), overlayX + 20, yOffset, 12, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Chunks: %d visible, %d culled", (int)render->visibleChunks, (int)render->culledChunks),
+                 overlayX + 20, yOffset, 12, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("LOD near/mid/far: res %d/%d/%d  eggs %d/%d/%d  players %d/%d/%d",
+                 (int)render->resourceInstances[LOD_NEAR], (int)render->resourceInstances[LOD_MID],
+                 (int)render->resourceInstances[LOD_FAR], (int)render->eggInstances[LOD_NEAR],
+                 (int)render->eggInstances[LOD_MID], (int)render->eggInstances[LOD_FAR],
+                 (int)render->playerInstances[LOD_NEAR], (int)render->playerInstances[LOD_MID],
+                 (int)render->playerInstances[LOD_FAR]), overlayX + 20, yOffset, 12, LIGHTGRAY);
+        yOffset += lineHeight;
+    }
     yOffset += lineHeight;
-    DrawText(TextFormat("Tiles: %d", (int)_mapInfo.tiles.size()), overlayX + 20, yOffset, 14, LIGHTGRAY);
-    yOffset += lineHeight * 2;
 
     DrawText("GAME INFO:", overlayX + 10, yOffset, 16, WHITE);
     yOffset += lineHeight;
     DrawText(TextFormat("Time Unit: %d", _gameInfo.timeUnit), overlayX + 20, yOffset, 14, LIGHTGRAY);
     yOffset += lineHeight;
-    DrawText(TextFormat("Teams: %d", (int)_gameInfo.teams.size()), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    DrawText(TextFormat("Teams: %d", (int)snapshot->getTeams().size()), overlayX + 20, yOffset, 14, LIGHTGRAY);
     yOffset += lineHeight;
-    DrawText(TextFormat("Players: %d", (int)_gameInfo.players.size()), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    DrawText(TextFormat("Players: %d", (int)snapshot->getPlayerCount()), overlayX + 20, yOffset, 14, LIGHTGRAY);
     yOffset += lineHeight;
-    DrawText(TextFormat("Eggs: %d", (int)_gameInfo.eggs.size()), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    DrawText(TextFormat("Eggs: %d", (int)snapshot->getEggCount()), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    yOffset += lineHeight;
+
+    const WorldStats &world = snapshot->getStats();
+    DrawText(TextFormat("Resources: food %llu  lin %llu  der %llu  sib %llu",
+             (unsigned long long)world.getResourceTotal(0), (unsigned long long)world.getResourceTotal(1),
+             (unsigned long long)world.getResourceTotal(2), (unsigned long long)world.getResourceTotal(3)),
+             overlayX + 20, yOffset, 12, LIGHTGRAY);
+    yOffset += lineHeight;
+    DrawText(TextFormat("           men %llu  phi %llu  thy %llu",
+             (unsigned long long)world.getResourceTotal(4), (unsigned long long)world.getResourceTotal(5),
+             (unsigned long long)world.getResourceTotal(6)),
+             overlayX + 20, yOffset, 12, LIGHTGRAY);
+    yOffset += lineHeight;
+    const DriftStats &drift = world.getDrift();
+    DrawText(TextFormat("Drift: tiles %llu/%llu  inventories %llu/%llu  units %llu",
+             (unsigned long long)drift.tileDrifts, (unsigned long long)drift.tileChecks,
+             (unsigned long long)drift.inventoryDrifts, (unsigned long long)drift.inventoryChecks,
+             (unsigned long long)drift.driftUnits),
+             overlayX + 20, yOffset, 12, LIGHTGRAY);
+    yOffset += lineHeight;
+    const auto &levels = world.getLevels();
+    DrawText(TextFormat("Levels 1-8: %d %d %d %d %d %d %d %d",
+             levels[1], levels[2], levels[3], levels[4], levels[5], levels[6], levels[7], levels[8]),
+             overlayX + 20, yOffset, 12, LIGHTGRAY);
     yOffset += lineHeight;
 
     if (!_gameInfo.winner.empty()) {
@@ -387,30 +660,88 @@ void GUI::Core::drawInfoOverlay()
     }
     yOffset += lineHeight;
 
+    if (_network_thread) {
+        IngestReport report;
+        {
+            std::lock_guard<std::mutex> lock(_report_mutex);
+            report = _report;
+        }
+        const NetworkStats &network = report.network;
+        DrawText("NETWORK:", overlayX + 10, yOffset, 16, WHITE);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Queue: %d in / %d out", (int)network.inbound_depth, (int)network.outbound_depth),
+                 overlayX + 20, yOffset, 14, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Messages: %llu  Stalls: %llu  Dropped: %llu",
+                 (unsigned long long)network.messages_received,
+                 (unsigned long long)network.inbound_stalls,
+                 (unsigned long long)network.dropped_commands),
+                 overlayX + 20, yOffset, 14, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Outbound: %d B pending (peak %d B), %llu writes%s",
+                 (int)network.outbound_pending_bytes, (int)network.outbound_peak_bytes,
+                 (unsigned long long)network.send_calls, network.congested ? ", CONGESTED" : ""),
+                 overlayX + 20, yOffset, 12, network.congested ? ORANGE : LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Queries/s: ppo %.1f  plv %.1f  pin %.1f  bct %.1f",
+                 report.queryRates[static_cast<std::size_t>(QueryKind::Position)],
+                 report.queryRates[static_cast<std::size_t>(QueryKind::Level)],
+                 report.queryRates[static_cast<std::size_t>(QueryKind::Inventory)],
+                 report.queryRates[static_cast<std::size_t>(QueryKind::Tile)]),
+                 overlayX + 20, yOffset, 12, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Behind: %d KB (socket %d, buffer %d, queue %d), oldest %.0f ms",
+                 (int)((network.kernel_pending_bytes + network.buffered_bytes + network.queued_bytes) / 1024),
+                 (int)(network.kernel_pending_bytes / 1024), (int)(network.buffered_bytes / 1024),
+                 (int)(network.queued_bytes / 1024), network.oldest_message_age * 1000.0),
+                 overlayX + 20, yOffset, 12, LIGHTGRAY);
+        yOffset += lineHeight;
+        DrawText(TextFormat("Heap allocs: frame %llu, ingest step %.1f, publish %.1f",
+                 (unsigned long long)_frameAllocations, report.stepAllocations, report.publishAllocations),
+                 overlayX + 20, yOffset, 12, _frameAllocations == 0 ? LIGHTGRAY : ORANGE);
+        yOffset += lineHeight * 2;
+    }
+
     DrawText("TEAMS:", overlayX + 10, yOffset, 16, WHITE);
     yOffset += lineHeight;
-    for (const auto& team : _gameInfo.teams) {
-        DrawText(team.c_str(), overlayX + 20, yOffset, 14, LIGHTGRAY);
+    const std::vector<std::string> &teams = snapshot->getTeams();
+    const std::vector<TeamStats> &teamStats = world.getTeams();
+    for (std::size_t team = 0; team < teams.size(); team++) {
+        if (team >= teamStats.size()) {
+            DrawText(teams[team].c_str(), overlayX + 20, yOffset, 14, LIGHTGRAY);
+            yOffset += lineHeight;
+            continue;
+        }
+        int highest = 0;
+        for (int level = TeamStats::MAX_LEVEL; level > 0 && highest == 0; level--)
+            highest = teamStats[team].levels[level] > 0 ? level : 0;
+        DrawText(TextFormat("%s: %d players, %d eggs, best Lv.%d", teams[team].c_str(),
+                 teamStats[team].players, teamStats[team].eggs, highest),
+                 overlayX + 20, yOffset, 14, LIGHTGRAY);
         yOffset += lineHeight;
     }
     yOffset += lineHeight;
 
     DrawText("PLAYERS:", overlayX + 10, yOffset, 16, WHITE);
     yOffset += lineHeight;
+    const int maxPlayers = std::min(10, (overlayY + overlayHeight - 40 - yOffset) / lineHeight - 1);
     int playerCount = 0;
-    for (const auto& [id, player] : _gameInfo.players) {
-        if (playerCount >= 10) {
-            DrawText("...", overlayX + 20, yOffset, 14, LIGHTGRAY);
-            break;
+    snapshot->forEachPlayerPage([&](const PlayerColumns &players) {
+        for (std::size_t row = 0; row < players.size() && playerCount <= maxPlayers; row++) {
+            if (playerCount == maxPlayers) {
+                DrawText("...", overlayX + 20, yOffset, 14, LIGHTGRAY);
+                playerCount++;
+                break;
+            }
+            DrawText(TextFormat("#%d (%s) Lv.%d",
+                     players.id[row],
+                     players.team[row] < teams.size() ? teams[players.team[row]].c_str() : "?",
+                     players.level[row]),
+                     overlayX + 20, yOffset, 12, LIGHTGRAY);
+            yOffset += lineHeight;
+            playerCount++;
         }
-        DrawText(TextFormat("%s (%s) Lv.%d",
-                 player.getName().c_str(),
-                 player.getTeam().c_str(),
-                 player.getLevel()),
-                 overlayX + 20, yOffset, 12, LIGHTGRAY);
-        yOffset += lineHeight;
-        playerCount++;
-    }
+    });
 
     DrawText("Press 'I' to close", overlayX + 10, overlayY + overlayHeight - 30, 14, YELLOW);
 }
@@ -419,13 +750,46 @@ void GUI::Core::drawInfoOverlay()
  * @brief Sends a command to the server
  * @param command Command to send to the server
  *
- * Uses the NetworkManager to send the specified command to the server.
- * Displays an error message if sending fails.
+ * Queues the command on the network thread, which writes it to the socket.
+ * Displays an error message if the command could not be queued.
  */
-void GUI::Core::send_command(const std::string& command)
+void GUI::Core::send_command(std::string_view command)
 {
-    if (!_network_manager->send_command(command))
-        std::cerr << "Failed to send command: " << command << std::endl;
+    if (!_network_thread || !_network_thread->send_command(command))
+        ZLOG_ERROR(Network, "Failed to send command: %.*s", (int)command.size(), command.data());
+}
+
+/**
+ * @brief Sends a periodic query chosen by the refresh scheduler
+ * @param query Query to format and send
+ *
+ * Formats the query as a protocol command (ppo/plv/pin #n, or bct X Y) in
+ * a stack buffer and sends it with send_command(), so no string is
+ * allocated per query.
+ */
+void GUI::Core::send_query(const Query &query)
+{
+    char command[32];
+    int length = 0;
+
+    switch (query.kind) {
+        case QueryKind::Position:
+            length = std::snprintf(command, sizeof(command), "ppo #%d", query.id);
+            break;
+        case QueryKind::Level:
+            length = std::snprintf(command, sizeof(command), "plv #%d", query.id);
+            break;
+        case QueryKind::Inventory:
+            length = std::snprintf(command, sizeof(command), "pin #%d", query.id);
+            break;
+        case QueryKind::Tile:
+            length = std::snprintf(command, sizeof(command), "bct %d %d", query.x, query.y);
+            break;
+        default:
+            break;
+    }
+    if (length > 0)
+        send_command(std::string_view(command, static_cast<std::size_t>(length)));
 }
 
 /**
@@ -457,13 +821,35 @@ void GUI::Core::drawDeathMessages()
  * Starts the main game loop which:
  * 1. Initializes the Raylib window (1280x720)
  * 2. Creates the 3D camera with orbital controls
- * 3. Connects to the server and sends initial commands
- * 4. Executes the main rendering loop which:
+ * 3. Connects to the server and sends initial commands, or starts replaying
+ *    the capture file (the recorded session already contains the replies)
+ * 4. Starts the ingest thread, which applies the server messages to the
+ *    World and publishes snapshots of it (see ingest_loop())
+ * 5. Executes the main rendering loop which:
  *    - Handles user input (zoom, camera rotation, overlay)
- *    - Receives and processes server messages
+ *    - Applies the events posted by the ingest thread (sounds, deaths...)
+ *    - Takes the latest world snapshot and hands it to the map
  *    - Updates and displays the 3D map
  *    - Displays the user interface
  *    - Handles death messages
+ *    - Counts the heap allocations of the frame, shown in the overlay
+ *
+ * The render thread never waits for the ingest thread: it draws the latest
+ * complete snapshot while the next messages are being applied.
+ *
+ * Models, the background included, come from the asset cache: the Map
+ * rebuilt on each new map size, and the next run() after a reconnect,
+ * reuse them without reading a file. They are freed before the window
+ * closes.
+ *
+ * The models and sounds are preloaded in the background before the window
+ * opens, so the first frame is shown right away, with fallback shapes; each
+ * frame then finishes what the workers prepared (see AssetCache::update()):
+ * the sounds were decoded off the main thread, the models only read, and
+ * each model is parsed and uploaded on the main thread, in the frame it is
+ * finished.
+ * The time to the first frame and until every asset is loaded are logged
+ * and shown in the overlay.
  *
  * Controls:
  * - Mouse wheel: Zoom in/out
@@ -479,17 +865,28 @@ void GUI::Core::run()
     float zoom = 30.0f;
     const float minZoom = 5.0f;
     const float maxZoom = 100.0f;
+    const auto startTime = std::chrono::steady_clock::now();
+
+    _firstFrameMs = -1.0;
+    _assetsLoadedMs = -1.0;
+    _assets.preload({
+        "assets/background.glb", "assets/player.glb", "assets/egg.glb", "assets/food.glb",
+        "assets/firstmineral.glb", "assets/secondmineral.glb", "assets/thirdmineral.glb",
+        "assets/fourthmineral.glb", "assets/fifthmineral.glb", "assets/sixthmineral.glb"
+    }, _audio.getFiles());
 
     raylib::Window window(screenWidth, screenHeight, "Zappy-Pi");
-    Model backgroundModel = LoadModel("assets/background.glb");
+    ModelRelease releaseModels{_assets};
+    AssetCache::ModelHandle backgroundModel = _assets.getModel("assets/background.glb");
 
     SetTargetFPS(60);
 
     int mapWidth = 10;
     int mapHeight = 10;
     bool gridReady = false;
+    std::shared_ptr<const WorldSnapshot> snapshot;
 
-    std::unique_ptr<GUI::Map> map = std::make_unique<GUI::Map>(mapWidth, mapHeight, 1.0f);
+    std::unique_ptr<GUI::Map> map = std::make_unique<GUI::Map>(_assets, mapWidth, mapHeight, 1.0f);
 
     raylib::Camera3D camera(
         {10.0f, 20.0f, 30.0f},  // position
@@ -498,22 +895,26 @@ void GUI::Core::run()
         45.0f, CAMERA_PERSPECTIVE
     );
 
-    std::cout << "Connecting to " << _hostname << ":" << _port << std::endl;
+    if (_replay_path.empty())
+        ZLOG_INFO(Network, "Connecting to %s:%d", _hostname.c_str(), _port);
+    else
+        ZLOG_INFO(Network, "Replaying %s at speed %g", _replay_path.c_str(), _replay_speed);
     if (!connect_to_server())
-        throw CoreError("Failed to connect to server");
-
-    send_command("msz");
-    send_command("mct");
-    send_command("tna");
-    send_command("sgt");
+        throw CoreError(_replay_path.empty() ? "Failed to connect to server" : "Failed to open capture file");
+
+    const bool replaying = _network_thread->is_replaying();
+    if (!replaying) {
+        send_command("msz");
+        send_command("mct");
+        send_command("tna");
+        send_command("sgt");
+        _network_thread->flush_commands();
+    }
+    start_ingest(replaying);
 
     while (!window.ShouldClose())
     {
-        for (auto &player : this->_gameInfo.players)
-        {
-            send_command("ppo " + player.first);
-        }
-
+        const std::uint64_t frameStart = AllocationCounter::count();
         float wheelMove = raylib::Mouse::GetWheelMove();
         if (wheelMove != 0) {
             zoom -= wheelMove * 2.0f;
@@ -530,37 +931,25 @@ void GUI::Core::run()
         if (raylib::Keyboard::IsKeyPressed(KEY_I))
             _showInfoOverlay = !_showInfoOverlay;
 
-        if (_connected && _network_manager->poll_for_data())
-        {
-            char buffer[4096];
-            ssize_t bytes_read = _network_manager->receive_data(buffer, sizeof(buffer) - 1);
-            if (bytes_read <= 0) {
-                std::cout << "Server disconnected" << std::endl;
-                _connected = false;
-                break;
-            }
-
-            buffer[bytes_read] = '\0';
-            _comm_buffer->append_data(buffer);
-
-            auto messages = _comm_buffer->extract_all_messages();
-            for (const auto& message : messages) {
-                std::istringstream iss(message);
-                std::string command;
-                iss >> command;
+        if (_assets.update() && !backgroundModel)
+            backgroundModel = _assets.getModel("assets/background.glb");
 
-                if (command == "msz") {
-                    iss >> mapWidth >> mapHeight;
-                    std::cout << "Map size: " << mapWidth << "x" << mapHeight << std::endl;
-                    gridReady = true;
+        apply_events();
+        if (_ingest_finished && _events.empty())
+            break;
 
-                    map = std::make_unique<GUI::Map>(mapWidth, mapHeight, 1.0f);
+        snapshot = _snapshots.load();
+        if (snapshot != nullptr && snapshot->getWidth() > 0) {
+            if (!gridReady || snapshot->getWidth() != mapWidth || snapshot->getHeight() != mapHeight) {
+                mapWidth = snapshot->getWidth();
+                mapHeight = snapshot->getHeight();
+                gridReady = true;
 
-                    camera.target = {(float)mapWidth / 2, 0.0f, (float)mapHeight / 2};
-                }
+                map = std::make_unique<GUI::Map>(_assets, mapWidth, mapHeight, 1.0f);
 
-                handle_server_message(message);
+                camera.target = {(float)mapWidth / 2, 0.0f, (float)mapHeight / 2};
             }
+            map->sync(snapshot);
         }
 
         if (raylib::Mouse::IsButtonDown(MOUSE_BUTTON_RIGHT))
@@ -571,14 +960,10 @@ void GUI::Core::run()
 
         BeginMode3D(camera);
 
-        DrawModel(backgroundModel, { 0.0f, -50.0f, 0.0f }, 0.5f, WHITE);
+        if (backgroundModel)
+            DrawModel(*backgroundModel, { 0.0f, -50.0f, 0.0f }, 0.5f, WHITE);
         if (gridReady)
-        {
-            map->updateTileData(_mapInfo.tiles);
-            map->updatePlayerData(_gameInfo.players);
-            map->updateEggData(_gameInfo.eggs);
-            map->render();
-        }
+            map->render(camera);
 
         EndMode3D();
 
@@ -590,12 +975,26 @@ void GUI::Core::run()
         DrawText("Press 'I' to toggle information overlay", 10, 35, 20, DARKGRAY);
 
         if (_showInfoOverlay)
-            drawInfoOverlay();
+            drawInfoOverlay(snapshot.get(), gridReady ? &map->getRenderStats() : nullptr);
 
         drawDeathMessages();
 
         window.EndDrawing();
+        _frameAllocations = AllocationCounter::count() - frameStart;
+
+        if (_firstFrameMs < 0.0 || _assetsLoadedMs < 0.0) {
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            if (_firstFrameMs < 0.0) {
+                _firstFrameMs = elapsed;
+                ZLOG_INFO(Core, "First frame shown after %.0f ms", elapsed);
+            }
+            if (_assetsLoadedMs < 0.0 && !_assets.isLoading()) {
+                _assetsLoadedMs = elapsed;
+                ZLOG_INFO(Core, "Assets loaded after %.0f ms", elapsed);
+            }
+        }
     }
+    stop_ingest();
 }
 
 /**
@@ -611,15 +1010,31 @@ void GUI::Core::run()
  * Expected arguments:
  * - -p <port> : Server port
  * - -h <hostname> : Server hostname
+ * - --ingest-bytes <n> : Optional, maximum bytes ingested per step
+ * - --ingest-ms <n> : Optional, maximum milliseconds spent ingesting per step
+ * - --debug : Optional, logs every server message (same as --log-level debug)
+ * - --log-level <level> : Optional, minimum level logged (default info)
+ * - --log-categories <list> : Optional, comma separated categories logged (default all)
+ * - --record <file> : Optional, stores everything received from the server
+ * - --replay <file> : Replays a capture instead of connecting (-p and -h not needed)
+ * - --speed <n> : Optional, replay speed factor (default 1, 0 = as fast as possible)
+ *
+ * The logger's writer thread runs for the whole execution and is stopped,
+ * writing out pending records, before the error message if any.
  */
 int execute_zappygui(char **argv)
 {
+    GUI::Logger &logger = GUI::Logger::instance();
+    logger.start();
+
     try {
         GUI::Core core(argv);
         core.run();
     } catch (const GUI::Core::CoreError &error) {
+        logger.stop();
         std::cerr << "Core error: " << error.what() << std::endl;
         return 1;
     }
+    logger.stop();
     return 0;
 }
@@ -7,49 +7,89 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <exception>
 #include <utility>
 #include <vector>
 #include <map>
-#include "../player/Player.hpp"
 #include <unordered_map>
 #include "../../include/raylib-cpp.hpp"
 #include "../clock/Clock.hpp"
 #include "../audio/Audio.hpp"
+#include "../network/NetworkThread.hpp"
+#include "../scheduler/RefreshScheduler.hpp"
+#include "../protocol/Protocol.hpp"
+#include "../world/World.hpp"
 
 namespace GUI {
-    class NetworkManager;
-    class CommunicationBuffer;
 
-    struct TileInfo {
-        int x, y;
-        std::vector<int> resources;
-    };
+    struct RenderStats;
 
     struct DeathMessage {
         std::string text;
         double timestamp;
     };
 
-    struct EggInfo {
-        std::string id;
-        std::string player_id;
-        int x, y;
+    /**
+     * @brief Something the ingest thread hands over to the render thread
+     *
+     * Sounds and on-screen messages are triggered by server messages but
+     * must happen on the render thread; they travel through an SPSC queue
+     * instead of the world snapshot.
+     */
+    struct IngestEvent {
+        enum class Kind {
+            Sound,
+            PlayerDeath,    // value: player number
+            TimeUnit,       // value: frequency
+            GameEnd         // text: winning team
+        };
+
+        Kind kind = Kind::Sound;
+        const char *sound = nullptr;
+        int value = 0;
+        std::string text;
+    };
+
+    /**
+     * @brief Heap allocations of a repeated step, averaged over its samples
+     */
+    struct AllocationTally {
+        std::uint64_t allocations = 0;
+        std::uint64_t samples = 0;
+
+        void add(std::uint64_t count)
+        {
+            allocations += count;
+            samples++;
+        }
+
+        [[nodiscard]] double average() const
+        {
+            return samples == 0 ? 0.0 : static_cast<double>(allocations) / static_cast<double>(samples);
+        }
     };
 
-    struct MapInfo {
-        int width = 0;
-        int height = 0;
-        std::map<std::pair<int, int>, TileInfo> tiles;
+    /**
+     * @brief Counters only readable on the ingest thread, copied for the overlay
+     */
+    struct IngestReport {
+        NetworkStats network;
+        std::array<double, RefreshScheduler::KIND_COUNT> queryRates{};
+        double stepAllocations = 0.0;       // per ingest step that handled messages
+        double publishAllocations = 0.0;    // per World::publish()
     };
 
     struct GameInfo {
         int timeUnit = 0;
-        std::vector<std::string> teams;
-        std::unordered_map<std::string, Player> players;
-        std::unordered_map<std::string, EggInfo> eggs;
         std::string winner;
     };
 
@@ -67,10 +107,16 @@ namespace GUI {
             ~Core();
 
             bool connect_to_server();
-            void handle_server_message(const std::string &message);
-            void send_command(const std::string& command);
+            void handle_server_message(const Protocol::Message &message);
+            void send_command(std::string_view command);
+            void send_query(const Query &query);
             void run();
 
+            static constexpr std::size_t EVENT_CAPACITY = 1024;
+            static constexpr std::chrono::milliseconds MAX_PUBLISH_DELAY{100};
+            static constexpr std::chrono::milliseconds REPORT_INTERVAL{100};
+            static constexpr std::chrono::milliseconds MAP_FENCE_STALL{2000};
+
             void drawDeathMessages();
 
             GUI::AudioManager &getAudioManager() { 
@@ -78,24 +124,46 @@ namespace GUI {
             }
 
         private:
-            std::unique_ptr<NetworkManager> _network_manager;
-            std::unique_ptr<CommunicationBuffer> _comm_buffer;
+            std::unique_ptr<NetworkThread> _network_thread;
             std::string _hostname;
             int _port;
+            IngestBudget _ingest_budget;
+            std::string _record_path;
+            std::string _replay_path;
+            double _replay_speed;
             int _timeUnit;
-            bool _connected;
-            int _server_fd;
 
             bool _showInfoOverlay;
-            MapInfo _mapInfo;
+            std::uint64_t _frameAllocations;
+            double _firstFrameMs;       // from run() to the first frame shown, -1 before
+            double _assetsLoadedMs;     // from run() to the last preloaded asset, -1 before
+            World _world;
             GameInfo _gameInfo;
 
             std::unique_ptr<Clock> _clock;
 
-            std::vector<DeathMessage> _deathMessages;
+            RefreshScheduler _scheduler;
+            std::vector<Query> _queries;
 
-            void drawInfoOverlay();
+            std::vector<DeathMessage> _deathMessages;
 
+            SnapshotSlot _snapshots;
+            SPSCQueue<IngestEvent> _events;
+            std::thread _ingest_thread;
+            std::atomic<bool> _ingest_running;
+            std::atomic<bool> _ingest_finished;
+            std::mutex _report_mutex;
+            IngestReport _report;
+
+            void start_ingest(bool replaying);
+            void stop_ingest();
+            void ingest_loop(bool replaying);
+            void publish_report(const AllocationTally &steps, const AllocationTally &publishes);
+            void post_event(IngestEvent::Kind kind, const char *sound, int value = 0, std::string_view text = {});
+            void apply_events();
+            void drawInfoOverlay(const WorldSnapshot *snapshot, const RenderStats *render);
+
+            AssetCache _assets;
             GUI::AudioManager _audio;
     };
 } // namespace GUI
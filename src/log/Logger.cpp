@@ -0,0 +1,345 @@
+/**
+ * @file Logger.cpp
+ * @brief Implementation of the asynchronous Logger for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the Logger class. Log calls made on
+ * the render and network threads format their text into a slot of a bounded
+ * multi-producer ring (Vyukov's sequence-numbered cells) and return without
+ * taking a lock or making a system call. A background thread collects the
+ * records every few milliseconds, formats them as
+ * "[seconds] LEVEL category: text" lines and writes each batch with a single
+ * write and flush: Trace to Info go to standard output, Warning and Error to
+ * standard error.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Logger.cpp
+*/
+
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <utility>
+
+static_assert((GUI::Logger::RING_CAPACITY & (GUI::Logger::RING_CAPACITY - 1)) == 0,
+    "Logger::RING_CAPACITY must be a power of two");
+
+namespace {
+
+    const char *level_name(GUI::LogLevel level)
+    {
+        switch (level) {
+            case GUI::LogLevel::Trace: return "TRACE";
+            case GUI::LogLevel::Debug: return "DEBUG";
+            case GUI::LogLevel::Info: return "INFO ";
+            case GUI::LogLevel::Warning: return "WARN ";
+            case GUI::LogLevel::Error: return "ERROR";
+            default: return "?    ";
+        }
+    }
+
+    struct CategoryName {
+        GUI::LogCategory category;
+        const char *name;
+    };
+
+    constexpr CategoryName CATEGORY_NAMES[] = {
+        {GUI::LogCategory::Core, "core"},
+        {GUI::LogCategory::Network, "network"},
+        {GUI::LogCategory::Protocol, "protocol"},
+        {GUI::LogCategory::Render, "render"},
+        {GUI::LogCategory::Audio, "audio"},
+    };
+
+    const char *category_name(GUI::LogCategory category)
+    {
+        for (const auto &entry : CATEGORY_NAMES) {
+            if (entry.category == category)
+                return entry.name;
+        }
+        return "?";
+    }
+
+} // namespace
+
+/**
+ * @brief Returns the process-wide logger
+ *
+ * @return Logger& The logger, created on first use
+ */
+GUI::Logger &GUI::Logger::instance()
+{
+    static Logger logger;
+    return logger;
+}
+
+/**
+ * @brief Constructs the logger with an empty ring
+ *
+ * Records are accepted right away, but only written out once start() has
+ * been called (or when the logger is stopped).
+ * The default verbosity is Info for every category: per-message protocol
+ * logs are Debug and Trace, so they cost nothing unless enabled.
+ */
+GUI::Logger::Logger()
+    : _cells(new Cell[RING_CAPACITY]), _enqueue(0), _dequeue(0), _dropped(0),
+      _level(LogLevel::Info), _categories(LOG_ALL_CATEGORIES),
+      _epoch(std::chrono::steady_clock::now()), _running(false)
+{
+    for (std::size_t i = 0; i < RING_CAPACITY; i++)
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destructor of the Logger class
+ *
+ * Stops the writer thread, which writes out every pending record.
+ */
+GUI::Logger::~Logger()
+{
+    stop();
+}
+
+/**
+ * @brief Starts the background writer thread
+ *
+ * @note Calling start() on a running logger has no effect
+ */
+void GUI::Logger::start()
+{
+    if (_running.exchange(true))
+        return;
+    _thread = std::thread(&Logger::loop, this);
+}
+
+/**
+ * @brief Stops the writer thread and writes out pending records
+ *
+ * Must be called before the process exits so the last records are not lost;
+ * records logged after stop() are written by the next start() or stop().
+ */
+void GUI::Logger::stop()
+{
+    if (_running.exchange(false)) {
+        _wake.notify_one();
+        if (_thread.joinable())
+            _thread.join();
+        return;
+    }
+
+    std::string out;
+    std::string err;
+    std::lock_guard<std::mutex> lock(_mutex);
+    while (drain(out, err)) {}
+}
+
+/**
+ * @brief Sets the minimum level of the records kept
+ *
+ * @param level Records below this level are discarded at the call site
+ */
+void GUI::Logger::setLevel(LogLevel level)
+{
+    _level.store(level, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Sets which categories are logged
+ *
+ * @param mask Bitwise or of LogCategory values
+ */
+void GUI::Logger::setCategories(std::uint32_t mask)
+{
+    _categories.store(mask, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Formats a record into the ring
+ *
+ * Claims a cell, formats the text in place with vsnprintf and publishes it.
+ * Text longer than LogRecord::MAX_TEXT is truncated.
+ *
+ * @param level Level of the record
+ * @param category Category of the record
+ * @param format printf-style format string
+ *
+ * @note Never blocks: if the writer thread is behind and the ring is full,
+ *       the record is dropped and counted in getDropped()
+ * @note Call through the ZLOG_* macros so disabled records cost nothing
+ */
+void GUI::Logger::write(LogLevel level, LogCategory category, const char *format, ...)
+{
+    std::size_t pos = _enqueue.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+
+    for (;;) {
+        cell = &_cells[pos & (RING_CAPACITY - 1)];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = _enqueue.load(std::memory_order_relaxed);
+        }
+    }
+
+    LogRecord &record = cell->record;
+    record.time = std::chrono::steady_clock::now();
+    record.level = level;
+    record.category = category;
+
+    va_list args;
+    va_start(args, format);
+    const int length = std::vsnprintf(record.text, LogRecord::MAX_TEXT, format, args);
+    va_end(args);
+    record.length = static_cast<std::uint16_t>(length < 0 ? 0
+        : std::min<std::size_t>(static_cast<std::size_t>(length), LogRecord::MAX_TEXT - 1));
+
+    cell->sequence.store(pos + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the number of records dropped because the ring was full
+ *
+ * @return uint64_t Dropped record count since startup
+ */
+std::uint64_t GUI::Logger::getDropped() const
+{
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Parses a level name given on the command line
+ *
+ * @param text One of trace, debug, info, warning, error, off
+ * @param level Receives the parsed level
+ * @return true if the name is known
+ */
+bool GUI::Logger::parseLevel(std::string_view text, LogLevel &level)
+{
+    static constexpr std::pair<std::string_view, LogLevel> LEVELS[] = {
+        {"trace", LogLevel::Trace}, {"debug", LogLevel::Debug}, {"info", LogLevel::Info},
+        {"warning", LogLevel::Warning}, {"error", LogLevel::Error}, {"off", LogLevel::Off},
+    };
+
+    for (const auto &[name, value] : LEVELS) {
+        if (text == name) {
+            level = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parses a comma separated category list given on the command line
+ *
+ * @param text Category names (core, network, protocol, render, audio) or "all"
+ * @param mask Receives the matching bitmask
+ * @return true if every name is known
+ */
+bool GUI::Logger::parseCategories(std::string_view text, std::uint32_t &mask)
+{
+    std::uint32_t result = 0;
+
+    while (!text.empty()) {
+        const std::size_t comma = text.find(',');
+        const std::string_view name = text.substr(0, comma);
+        text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+
+        if (name == "all") {
+            result = LOG_ALL_CATEGORIES;
+            continue;
+        }
+        bool found = false;
+        for (const auto &entry : CATEGORY_NAMES) {
+            if (name == entry.name) {
+                result |= static_cast<std::uint32_t>(entry.category);
+                found = true;
+            }
+        }
+        if (!found)
+            return false;
+    }
+    mask = result;
+    return true;
+}
+
+/**
+ * @brief Moves the published records out of the ring and writes them
+ *
+ * Formats up to BATCH_BYTES of records into @p out and @p err, then writes
+ * each non-empty batch with one fwrite and one fflush.
+ *
+ * @param out Reused buffer for standard output
+ * @param err Reused buffer for standard error
+ * @return true if records were written and more may be pending
+ *
+ * @note Only one thread drains at a time (the writer thread, or stop())
+ */
+bool GUI::Logger::drain(std::string &out, std::string &err)
+{
+    char prefix[64];
+
+    out.clear();
+    err.clear();
+    while (out.size() + err.size() < BATCH_BYTES) {
+        Cell &cell = _cells[_dequeue & (RING_CAPACITY - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != _dequeue + 1)
+            break;
+
+        const LogRecord &record = cell.record;
+        const std::chrono::duration<double> time = record.time - _epoch;
+        const int length = std::snprintf(prefix, sizeof(prefix), "[%10.4f] %s %s: ",
+            time.count(), level_name(record.level), category_name(record.category));
+
+        std::string &target = record.level >= LogLevel::Warning ? err : out;
+        target.append(prefix, static_cast<std::size_t>(length > 0 ? length : 0));
+        target.append(record.text, record.length);
+        target.push_back('\n');
+
+        cell.sequence.store(_dequeue + RING_CAPACITY, std::memory_order_release);
+        _dequeue++;
+    }
+
+    if (!out.empty()) {
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        std::fflush(stdout);
+    }
+    if (!err.empty()) {
+        std::fwrite(err.data(), 1, err.size(), stderr);
+        std::fflush(stderr);
+    }
+    return !out.empty() || !err.empty();
+}
+
+/**
+ * @brief Body of the writer thread
+ *
+ * Wakes up every WRITE_INTERVAL and writes everything logged since. Producers
+ * never signal the thread, so logging does not make system calls.
+ */
+void GUI::Logger::loop()
+{
+    std::string out;
+    std::string err;
+    out.reserve(BATCH_BYTES);
+    err.reserve(BATCH_BYTES);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_running.load(std::memory_order_relaxed)) {
+        while (drain(out, err)) {}
+        _wake.wait_for(lock, WRITE_INTERVAL);
+    }
+    while (drain(out, err)) {}
+}
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Logger.hpp
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#if defined(__GNUC__)
+    #define ZAPPY_PRINTF_FORMAT(fmt, args) __attribute__((format(printf, fmt, args)))
+#else
+    #define ZAPPY_PRINTF_FORMAT(fmt, args)
+#endif
+
+namespace GUI {
+
+    enum class LogLevel : std::uint8_t {
+        Trace = 0,
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Off
+    };
+
+    enum class LogCategory : std::uint32_t {
+        Core = 1u << 0,
+        Network = 1u << 1,
+        Protocol = 1u << 2,
+        Render = 1u << 3,
+        Audio = 1u << 4
+    };
+
+    constexpr std::uint32_t LOG_ALL_CATEGORIES = 0xFFFFFFFFu;
+
+    struct LogRecord {
+        static constexpr std::size_t MAX_TEXT = 232;
+
+        std::chrono::steady_clock::time_point time;
+        LogLevel level;
+        LogCategory category;
+        std::uint16_t length;
+        char text[MAX_TEXT];
+    };
+
+    /**
+     * @brief Process-wide asynchronous logger
+     *
+     * Log calls format their text straight into a slot of a bounded lock-free
+     * ring (multiple producers, one consumer) and return; a background thread
+     * writes the records out in batches, with one write and one flush per
+     * batch. When the ring is full the record is dropped and counted rather
+     * than blocking the caller.
+     *
+     * Use the ZLOG_* macros: they test the level and category before any
+     * argument is evaluated, so a disabled log statement costs two relaxed
+     * atomic loads.
+     */
+    class Logger {
+        public:
+            static constexpr std::size_t RING_CAPACITY = 8192;
+            static constexpr std::size_t BATCH_BYTES = 64 * 1024;
+            static constexpr std::chrono::milliseconds WRITE_INTERVAL{10};
+
+            static Logger &instance();
+
+            Logger(const Logger &) = delete;
+            Logger &operator=(const Logger &) = delete;
+
+            void start();
+            void stop();
+
+            void setLevel(LogLevel level);
+            void setCategories(std::uint32_t mask);
+
+            [[nodiscard]] bool isEnabled(LogLevel level, LogCategory category) const
+            {
+                return level >= _level.load(std::memory_order_relaxed)
+                    && (static_cast<std::uint32_t>(category) & _categories.load(std::memory_order_relaxed)) != 0;
+            }
+
+            void write(LogLevel level, LogCategory category, const char *format, ...) ZAPPY_PRINTF_FORMAT(4, 5);
+
+            [[nodiscard]] std::uint64_t getDropped() const;
+
+            static bool parseLevel(std::string_view text, LogLevel &level);
+            static bool parseCategories(std::string_view text, std::uint32_t &mask);
+
+        private:
+            struct Cell {
+                std::atomic<std::size_t> sequence;
+                LogRecord record;
+            };
+
+            Logger();
+            ~Logger();
+
+            bool drain(std::string &out, std::string &err);
+            void loop();
+
+            std::unique_ptr<Cell[]> _cells;
+            alignas(64) std::atomic<std::size_t> _enqueue;
+            alignas(64) std::size_t _dequeue;
+            alignas(64) std::atomic<std::uint64_t> _dropped;
+
+            std::atomic<LogLevel> _level;
+            std::atomic<std::uint32_t> _categories;
+            std::chrono::steady_clock::time_point _epoch;
+
+            std::thread _thread;
+            std::atomic<bool> _running;
+            std::mutex _mutex;
+            std::condition_variable _wake;
+    };
+} // namespace GUI
+
+#define ZAPPY_LOG(level, category, ...) \
+    do { \
+        GUI::Logger &zappy_logger_ = GUI::Logger::instance(); \
+        if (zappy_logger_.isEnabled(level, GUI::LogCategory::category)) \
+            zappy_logger_.write(level, GUI::LogCategory::category, __VA_ARGS__); \
+    } while (0)
+
+#define ZLOG_TRACE(category, ...) ZAPPY_LOG(GUI::LogLevel::Trace, category, __VA_ARGS__)
+#define ZLOG_DEBUG(category, ...) ZAPPY_LOG(GUI::LogLevel::Debug, category, __VA_ARGS__)
+#define ZLOG_INFO(category, ...) ZAPPY_LOG(GUI::LogLevel::Info, category, __VA_ARGS__)
+#define ZLOG_WARNING(category, ...) ZAPPY_LOG(GUI::LogLevel::Warning, category, __VA_ARGS__)
+#define ZLOG_ERROR(category, ...) ZAPPY_LOG(GUI::LogLevel::Error, category, __VA_ARGS__)
@@ -8,11 +8,17 @@
  * application. It handles command-line argument parsing and validation before
  * launching the core application.
  *
- * The program expects exactly 4 command-line arguments:
+ * The program expects at least 4 command-line arguments:
  * - Port specification: -p <port_number>
  * - Machine specification: -h <hostname/IP>
- *
- * Usage: ./zappy_gui -p port -h machine
+ * or a capture to replay instead: --replay <file> [--speed <n>]
+ * - Optional ingest budget: --ingest-bytes <n>, --ingest-ms <n>
+ * - Optional logging: --debug, --log-level <level>, --log-categories <list>
+ * - Optional capture: --record <file>
+ *
+ * Usage: ./zappy_gui -p port -h machine [--ingest-bytes n] [--ingest-ms n]
+ *        [--debug] [--log-level level] [--log-categories list] [--record file]
+ *        ./zappy_gui --replay file [--speed n] [options]
  */
 
 #include <iostream>
@@ -24,14 +30,48 @@
  * Prints the correct usage format for the ZappyGUI application to standard output.
  * This function is called when invalid arguments are provided or when help is needed.
  *
- * The expected format is: ./zappy_gui -p port -h machine
+ * The expected format is: ./zappy_gui -p port -h machine [options]
  * Where:
  * - -p: Specifies the port number to connect to
  * - -h: Specifies the hostname or IP address of the machine to connect to
+ * - --ingest-bytes: Maximum number of bytes ingested per step
+ * - --ingest-ms: Maximum time in milliseconds spent ingesting per step
+ * - --debug: Logs every server message
+ * - --log-level: Minimum level logged (trace, debug, info, warning, error, off)
+ * - --log-categories: Comma separated categories logged (core, network, protocol, render, audio, all)
+ * - --record: Stores everything received from the server to a capture file
+ * - --replay: Replays a capture file instead of connecting to a server
+ * - --speed: Replay speed factor (default 1, 0 = as fast as possible)
  */
 static void display_help(void)
 {
-    std::cout << "USAGE: ./zappy_gui -p port -h machine\n";
+    std::cout << "USAGE: ./zappy_gui -p port -h machine [--ingest-bytes n] [--ingest-ms n]\n"
+                 "                  [--debug] [--log-level level] [--log-categories list] [--record file]\n"
+                 "       ./zappy_gui --replay file [--speed n] [options]\n";
+}
+
+/**
+ * @brief Tells whether an option is known and expects a value
+ *
+ * @param arg The command-line argument to check
+ * @return bool True if arg is one of the supported options
+ */
+static bool is_known_option(const std::string &arg)
+{
+    return arg == "-p" || arg == "-h" || arg == "--ingest-bytes" || arg == "--ingest-ms"
+        || arg == "--log-level" || arg == "--log-categories" || arg == "--record"
+        || arg == "--replay" || arg == "--speed";
+}
+
+/**
+ * @brief Tells whether an argument is a known flag, taking no value
+ *
+ * @param arg The command-line argument to check
+ * @return bool True if arg is one of the supported flags
+ */
+static bool is_known_flag(const std::string &arg)
+{
+    return arg == "--debug";
 }
 
 /**
@@ -40,14 +80,17 @@ static void display_help(void)
  * Performs comprehensive validation of the command-line arguments to ensure
  * they meet the required format and constraints. The function checks:
  *
- * 1. Argument count: Must be exactly 5 (program name + 4 arguments)
+ * 1. Argument layout: Arguments come as option/value pairs, or single flags
  * 2. Null pointer validation: Ensures no argument is null
- * 3. Flag validation: Ensures arguments contain both -p and -h flags
- * 4. Flag positioning: Validates that flags are in correct positions (argv[1] and argv[3])
+ * 3. Flag validation: Ensures every option is known
+ * 4. Required flags: Ensures both -p and -h are present, unless --replay is
  *
  * Valid argument patterns:
  * - ./zappy_gui -p <port> -h <machine>
  * - ./zappy_gui -h <machine> -p <port>
+ * - Either of the above followed or preceded by --ingest-bytes <n> and/or --ingest-ms <n>,
+ *   --debug, --log-level <level>, --log-categories <list>, --record <file>
+ * - ./zappy_gui --replay <file> [--speed <n>] with any of the optional options
  *
  * @param argc The number of command-line arguments
  * @param argv Array of command-line argument strings
@@ -59,14 +102,31 @@ static void display_help(void)
  */
 static int check_args(int argc, char **argv)
 {
-    if (argc != 5 || argv[0] == nullptr ||
-        argv[1] == nullptr || argv[2] == nullptr ||
-        argv[3] == nullptr || argv[4] == nullptr) {
+    bool has_port = false;
+    bool has_host = false;
+    bool has_replay = false;
+
+    if (argc < 3) {
+        display_help();
+        return 84;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] == nullptr) {
             display_help();
             return 84;
         }
-    if ((std::string(argv[1]) != "-p" && std::string(argv[1]) != "-h") ||
-        (std::string(argv[3]) != "-p" && std::string(argv[3]) != "-h")) {
+        if (is_known_flag(argv[i]))
+            continue;
+        if (i + 1 >= argc || argv[i + 1] == nullptr || !is_known_option(argv[i])) {
+            display_help();
+            return 84;
+        }
+        has_port = has_port || std::string(argv[i]) == "-p";
+        has_host = has_host || std::string(argv[i]) == "-h";
+        has_replay = has_replay || std::string(argv[i]) == "--replay";
+        i++;
+    }
+    if (!has_replay && (!has_port || !has_host)) {
         display_help();
         return 84;
     }
@@ -83,16 +143,17 @@ static int check_args(int argc, char **argv)
  * 2. If validation fails, returns with error code 84
  * 3. If validation succeeds, delegates execution to execute_zappygui()
  *
- * The function expects exactly 4 command-line arguments in addition to the
- * program name, specifying connection parameters for the Zappy server.
+ * The function expects option/value pairs in addition to the program name,
+ * specifying connection parameters for the Zappy server.
  *
- * @param argc The number of command-line arguments (must be 5)
+ * @param argc The number of command-line arguments (at least 3)
  * @param argv Array of command-line argument strings containing:
  *             - argv[0]: Program name
- *             - argv[1]: Either "-p" or "-h" flag
- *             - argv[2]: Port number or hostname/IP
- *             - argv[3]: Either "-h" or "-p" flag (opposite of argv[1])
- *             - argv[4]: Hostname/IP or port number (opposite of argv[2])
+ *             - then option/value pairs: -p <port>, -h <machine>, and
+ *               optionally --ingest-bytes <n>, --ingest-ms <n>,
+ *               --log-level <level>, --log-categories <list>, --record <file>,
+ *               or the --debug flag; or --replay <file> [--speed <n>] instead
+ *               of -p and -h
  *
  * @return int Returns the exit code from execute_zappygui() if successful,
  *             or 84 if argument validation fails
@@ -0,0 +1,86 @@
+/**
+ * @file Frustum.cpp
+ * @brief Implementation of the Frustum class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the Frustum class. The planes
+ * are extracted from the rows of the view-projection matrix (Gribb and
+ * Hartmann), and a box is rejected when its corner furthest along a plane
+ * normal is still behind that plane.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** Frustum.cpp
+*/
+
+#include "Frustum.hpp"
+#include <raymath.h>
+#include <rlgl.h>
+
+/**
+ * @brief Builds the frustum of a camera
+ *
+ * Mirrors BeginMode3D(): perspective cameras use fovy as the vertical
+ * field of view, orthographic ones as the view height, both clipped at
+ * RL_CULL_DISTANCE_NEAR and RL_CULL_DISTANCE_FAR.
+ *
+ * @param camera Camera the scene is drawn with
+ * @param aspect Width over height of the render target
+ * @return The frustum of the camera
+ */
+GUI::Frustum GUI::Frustum::fromCamera(const Camera3D &camera, float aspect)
+{
+    const Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix projection;
+
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+        const double top = camera.fovy / 2.0;
+        const double right = top * aspect;
+        projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    } else {
+        projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    const Matrix m = MatrixMultiply(view, projection);
+    const Vector4 row0 = {m.m0, m.m4, m.m8, m.m12};
+    const Vector4 row1 = {m.m1, m.m5, m.m9, m.m13};
+    const Vector4 row2 = {m.m2, m.m6, m.m10, m.m14};
+    const Vector4 row3 = {m.m3, m.m7, m.m11, m.m15};
+    const auto add = [](Vector4 a, Vector4 b, float sign) -> Vector4 {
+        return {a.x + sign * b.x, a.y + sign * b.y, a.z + sign * b.z, a.w + sign * b.w};
+    };
+    Frustum frustum;
+
+    frustum._planes = {
+        add(row3, row0, 1.0f),     // left
+        add(row3, row0, -1.0f),    // right
+        add(row3, row1, 1.0f),     // bottom
+        add(row3, row1, -1.0f),    // top
+        add(row3, row2, 1.0f),     // near
+        add(row3, row2, -1.0f)     // far
+    };
+    return frustum;
+}
+
+/**
+ * @brief Tells whether a box may be visible
+ *
+ * @param box Axis-aligned box in world space
+ * @return false only if the box is entirely outside one of the planes
+ */
+bool GUI::Frustum::intersects(const BoundingBox &box) const
+{
+    for (const Vector4 &plane : _planes) {
+        const float x = plane.x >= 0.0f ? box.max.x : box.min.x;
+        const float y = plane.y >= 0.0f ? box.max.y : box.min.y;
+        const float z = plane.z >= 0.0f ? box.max.z : box.min.z;
+
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** Frustum.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <raylib.h>
+
+namespace GUI {
+
+    /**
+     * @brief Volume seen by a camera, as six inward-facing planes
+     *
+     * Built from the same view and projection matrices BeginMode3D() sets
+     * up, so what it rejects is really off screen. Boxes are tested
+     * conservatively: a box straddling a plane counts as visible.
+     */
+    class Frustum {
+        public:
+            static Frustum fromCamera(const Camera3D &camera, float aspect);
+
+            [[nodiscard]] bool intersects(const BoundingBox &box) const;
+
+        private:
+            std::array<Vector4, 6> _planes{};    // (normal, distance): inside when dot >= 0
+    };
+} // namespace GUI
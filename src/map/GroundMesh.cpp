@@ -0,0 +1,213 @@
+/**
+ * @file GroundMesh.cpp
+ * @brief Implementation of the GroundMesh class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the GroundMesh class. The
+ * geometry that used to be drawn every frame with one DrawCube and one
+ * DrawCubeWires per tile is generated once into vertex and index arrays,
+ * uploaded to the GPU with UploadMesh(), and drawn with DrawMesh() and the
+ * default material, whose shader multiplies the vertex colors.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** GroundMesh.cpp
+*/
+
+#include "GroundMesh.hpp"
+#include <algorithm>
+#include <cstring>
+#include <raymath.h>
+#include "../log/Logger.hpp"
+
+namespace {
+
+    /**
+     * @brief Vertex and index arrays of one chunk, filled quad by quad
+     */
+    struct MeshBuilder {
+        std::vector<float> vertices;
+        std::vector<unsigned char> colors;
+        std::vector<unsigned short> indices;
+
+        /**
+         * @brief Adds a quad; corners go counter-clockwise seen from its front
+         */
+        void quad(const Vector3 (&corners)[4], Color color)
+        {
+            const auto first = static_cast<unsigned short>(vertices.size() / 3);
+
+            for (const Vector3 &corner : corners) {
+                vertices.insert(vertices.end(), {corner.x, corner.y, corner.z});
+                colors.insert(colors.end(), {color.r, color.g, color.b, color.a});
+            }
+            indices.insert(indices.end(), {
+                first, static_cast<unsigned short>(first + 1), static_cast<unsigned short>(first + 2),
+                first, static_cast<unsigned short>(first + 2), static_cast<unsigned short>(first + 3)
+            });
+        }
+
+        /**
+         * @brief Adds a horizontal rectangle facing up
+         */
+        void top(float x0, float z0, float x1, float z1, float y, Color color)
+        {
+            quad({{x0, y, z0}, {x0, y, z1}, {x1, y, z1}, {x1, y, z0}}, color);
+        }
+
+        /**
+         * @brief Copies the arrays into a raylib mesh and uploads it
+         *
+         * The arrays are allocated with MemAlloc() so that UnloadMesh() can
+         * free them.
+         */
+        Mesh upload() const
+        {
+            Mesh mesh{};
+
+            mesh.vertexCount = static_cast<int>(vertices.size() / 3);
+            mesh.triangleCount = static_cast<int>(indices.size() / 3);
+            mesh.vertices = static_cast<float *>(MemAlloc(static_cast<unsigned int>(vertices.size() * sizeof(float))));
+            mesh.colors = static_cast<unsigned char *>(MemAlloc(static_cast<unsigned int>(colors.size())));
+            mesh.indices = static_cast<unsigned short *>(MemAlloc(static_cast<unsigned int>(indices.size() * sizeof(unsigned short))));
+            std::memcpy(mesh.vertices, vertices.data(), vertices.size() * sizeof(float));
+            std::memcpy(mesh.colors, colors.data(), colors.size());
+            std::memcpy(mesh.indices, indices.data(), indices.size() * sizeof(unsigned short));
+            UploadMesh(&mesh, false);
+            return mesh;
+        }
+    };
+
+} // namespace
+
+/**
+ * @brief Destructor of the GroundMesh class; releases the GPU meshes
+ */
+GUI::GroundMesh::~GroundMesh()
+{
+    release();
+}
+
+/**
+ * @brief Generates and uploads the ground meshes of a map
+ *
+ * Tile (x, y) is centered on (x, 0, y) * tileSize, TILE_HEIGHT thick, like
+ * the cubes it replaces. Tiles alternate between GREEN and DARKGREEN. A
+ * chunk holds at most 32 x 32 tiles, 66 grid lines and 128 border sides,
+ * well below the 65536 vertices a mesh with 16-bit indices can address.
+ *
+ * @param width Map width in tiles
+ * @param height Map height in tiles
+ * @param tileSize Size of a tile in world units
+ */
+void GUI::GroundMesh::build(int width, int height, float tileSize)
+{
+    release();
+    if (width <= 0 || height <= 0)
+        return;
+
+    const float half = tileSize / 2.0f;
+    const float top = TILE_HEIGHT / 2.0f;
+    const float bottom = -TILE_HEIGHT / 2.0f;
+    const float line = LINE_WIDTH * tileSize / 2.0f;
+    const float lineY = top + 0.002f;
+    const float mapX0 = -half;
+    const float mapZ0 = -half;
+    const float mapX1 = static_cast<float>(width) * tileSize - half;
+    const float mapZ1 = static_cast<float>(height) * tileSize - half;
+    MeshBuilder builder;
+
+    for (int cy = 0; cy < height; cy += CHUNK_SIZE) {
+        for (int cx = 0; cx < width; cx += CHUNK_SIZE) {
+            const int columns = std::min(CHUNK_SIZE, width - cx);
+            const int rows = std::min(CHUNK_SIZE, height - cy);
+            const float x0 = static_cast<float>(cx) * tileSize - half;
+            const float z0 = static_cast<float>(cy) * tileSize - half;
+            const float x1 = x0 + static_cast<float>(columns) * tileSize;
+            const float z1 = z0 + static_cast<float>(rows) * tileSize;
+
+            builder.vertices.clear();
+            builder.colors.clear();
+            builder.indices.clear();
+
+            for (int y = cy; y < cy + rows; y++) {
+                for (int x = cx; x < cx + columns; x++) {
+                    const float tx = static_cast<float>(x) * tileSize;
+                    const float tz = static_cast<float>(y) * tileSize;
+                    const Color color = (x + y) % 2 == 0 ? GREEN : DARKGREEN;
+
+                    builder.top(tx - half, tz - half, tx + half, tz + half, top, color);
+                    if (y == 0)
+                        builder.quad({{tx - half, top, mapZ0}, {tx + half, top, mapZ0},
+                            {tx + half, bottom, mapZ0}, {tx - half, bottom, mapZ0}}, color);
+                    if (y == height - 1)
+                        builder.quad({{tx + half, top, mapZ1}, {tx - half, top, mapZ1},
+                            {tx - half, bottom, mapZ1}, {tx + half, bottom, mapZ1}}, color);
+                    if (x == 0)
+                        builder.quad({{mapX0, top, tz + half}, {mapX0, top, tz - half},
+                            {mapX0, bottom, tz - half}, {mapX0, bottom, tz + half}}, color);
+                    if (x == width - 1)
+                        builder.quad({{mapX1, top, tz - half}, {mapX1, top, tz + half},
+                            {mapX1, bottom, tz + half}, {mapX1, bottom, tz - half}}, color);
+                }
+            }
+            for (int i = 0; i <= columns; i++) {
+                const float lx = x0 + static_cast<float>(i) * tileSize;
+                builder.top(lx - line, z0, lx + line, z1, lineY, WHITE);
+            }
+            for (int i = 0; i <= rows; i++) {
+                const float lz = z0 + static_cast<float>(i) * tileSize;
+                builder.top(x0, lz - line, x1, lz + line, lineY, WHITE);
+            }
+
+            _chunks.push_back(builder.upload());
+            _vertexCount += builder.vertices.size() / 3;
+        }
+    }
+
+    _material = LoadMaterialDefault();
+    _hasMaterial = true;
+    ZLOG_DEBUG(Render, "Ground built: %dx%d tiles, %zu chunks, %zu vertices",
+        width, height, _chunks.size(), _vertexCount);
+}
+
+/**
+ * @brief Frees the GPU meshes
+ */
+void GUI::GroundMesh::release()
+{
+    for (Mesh &mesh : _chunks)
+        UnloadMesh(mesh);
+    _chunks.clear();
+    _vertexCount = 0;
+    if (_hasMaterial) {
+        UnloadMaterial(_material);
+        _hasMaterial = false;
+    }
+}
+
+/**
+ * @brief Draws the visible chunks
+ *
+ * Chunks are numbered row by row, like the chunks of the world snapshots.
+ *
+ * @param visible One flag per chunk, 0 if the chunk is culled; chunks past
+ *        its end are drawn
+ * @return Number of draw calls issued
+ */
+std::size_t GUI::GroundMesh::draw(const std::vector<std::uint8_t> &visible) const
+{
+    std::size_t calls = 0;
+
+    for (std::size_t chunk = 0; chunk < _chunks.size(); chunk++) {
+        if (chunk < visible.size() && visible[chunk] == 0)
+            continue;
+        DrawMesh(_chunks[chunk], _material, MatrixIdentity());
+        calls++;
+    }
+    return calls;
+}
@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** GroundMesh.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "../world/WorldSnapshot.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Checkerboard ground of the map, baked into static meshes
+     *
+     * The ground is split in chunks of CHUNK_SIZE x CHUNK_SIZE tiles (the
+     * chunk size of the world snapshots). Each chunk is one GPU mesh holding
+     * the top of its tiles, colored per vertex, the white grid lines as thin
+     * quads just above them, and the sides of the tiles on the map border.
+     * Meshes are built once per map size; drawing the ground then costs one
+     * draw call per visible chunk, whatever the number of tiles.
+     *
+     * Meshes live in GPU memory: build() and release() must be called while
+     * the window (GL context) exists.
+     */
+    class GroundMesh {
+        public:
+            static constexpr int CHUNK_SIZE = TileChunk::CHUNK_SIZE;
+            static constexpr float TILE_HEIGHT = 0.1f;
+            static constexpr float LINE_WIDTH = 0.03f;    // in tiles
+
+            GroundMesh() = default;
+            ~GroundMesh();
+
+            GroundMesh(const GroundMesh &) = delete;
+            GroundMesh &operator=(const GroundMesh &) = delete;
+
+            void build(int width, int height, float tileSize);
+            void release();
+            std::size_t draw(const std::vector<std::uint8_t> &visible) const;
+
+            [[nodiscard]] std::size_t getChunkCount() const { return _chunks.size(); }
+            [[nodiscard]] std::size_t getVertexCount() const { return _vertexCount; }
+
+        private:
+            std::vector<Mesh> _chunks;
+            Material _material{};
+            bool _hasMaterial = false;
+            std::size_t _vertexCount = 0;
+    };
+} // namespace GUI
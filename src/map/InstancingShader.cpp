@@ -0,0 +1,149 @@
+/**
+ * @file InstancingShader.cpp
+ * @brief Implementation of the InstancingShader class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the InstancingShader class. The
+ * GLSL sources are embedded, so no asset file is needed; the vertex shader
+ * takes its model matrix from the instanceTransform attribute, which
+ * DrawMeshInstanced() fills from the transform array of each call.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** InstancingShader.cpp
+*/
+
+#include "InstancingShader.hpp"
+#include <rlgl.h>
+#include "../log/Logger.hpp"
+
+namespace {
+
+    const char *const VERTEX_SHADER = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec4 vertexColor;
+in mat4 instanceTransform;
+
+uniform mat4 mvp;
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+
+void main()
+{
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor;
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+    const char *const FRAGMENT_SHADER = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+out vec4 finalColor;
+
+void main()
+{
+    finalColor = texture(texture0, fragTexCoord) * colDiffuse * fragColor;
+}
+)";
+
+    /**
+     * @brief Multiplies two colors channel by channel, like DrawModelEx() tints
+     */
+    Color modulate(Color color, Color tint)
+    {
+        return {
+            static_cast<unsigned char>(color.r * tint.r / 255),
+            static_cast<unsigned char>(color.g * tint.g / 255),
+            static_cast<unsigned char>(color.b * tint.b / 255),
+            static_cast<unsigned char>(color.a * tint.a / 255)
+        };
+    }
+} // namespace
+
+/**
+ * @brief Destructor of the InstancingShader class; releases the shader
+ */
+GUI::InstancingShader::~InstancingShader()
+{
+    release();
+}
+
+/**
+ * @brief Compiles the shader and binds its matrix locations
+ *
+ * LoadShaderFromMemory() falls back to the default shader when compilation
+ * fails; that case is logged and draw() then issues one call per instance.
+ */
+void GUI::InstancingShader::load()
+{
+    release();
+    _shader = LoadShaderFromMemory(VERTEX_SHADER, FRAGMENT_SHADER);
+    if (_shader.id == rlGetShaderIdDefault()) {
+        ZLOG_WARNING(Render, "Instancing shader unavailable, models are drawn one by one");
+        return;
+    }
+    _shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(_shader, "mvp");
+    _shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(_shader, "instanceTransform");
+    _loaded = true;
+}
+
+/**
+ * @brief Frees the shader
+ */
+void GUI::InstancingShader::release()
+{
+    if (_loaded) {
+        UnloadShader(_shader);
+        _loaded = false;
+    }
+    _shader = Shader{};
+}
+
+/**
+ * @brief Draws a model once per transform
+ *
+ * Each mesh of the model is drawn with its own material, the shader swapped
+ * for this one and the diffuse color tinted as DrawModelEx() does.
+ * The transforms replace the model's own transform: callers fold it in.
+ *
+ * @param model Model to draw
+ * @param transforms World transform of each copy
+ * @param tint Color multiplied with the diffuse color of every material
+ * @return Number of draw calls issued
+ */
+std::size_t GUI::InstancingShader::draw(const Model &model, const std::vector<Matrix> &transforms, Color tint) const
+{
+    if (transforms.empty())
+        return 0;
+
+    std::size_t calls = 0;
+    for (int i = 0; i < model.meshCount; i++) {
+        Material material = model.materials[model.meshMaterial[i]];
+        Color &diffuse = material.maps[MATERIAL_MAP_DIFFUSE].color;
+        const Color original = diffuse;
+
+        diffuse = modulate(original, tint);
+        if (_loaded) {
+            material.shader = _shader;
+            DrawMeshInstanced(model.meshes[i], material, transforms.data(), static_cast<int>(transforms.size()));
+            calls++;
+        } else {
+            for (const Matrix &transform : transforms)
+                DrawMesh(model.meshes[i], material, transform);
+            calls += transforms.size();
+        }
+        diffuse = original;
+    }
+    return calls;
+}
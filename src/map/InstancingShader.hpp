@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** InstancingShader.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <raylib.h>
+
+namespace GUI {
+
+    /**
+     * @brief Shader drawing many copies of a model in one call per mesh
+     *
+     * raylib's DrawMeshInstanced() only works with a shader that reads the
+     * model matrix from a per-instance vertex attribute; the default shader
+     * does not. This one does, and otherwise shades like the default shader
+     * (diffuse texture, diffuse color and vertex colors).
+     *
+     * The shader lives in GPU memory: load() and release() must be called
+     * while the window (GL context) exists. If it fails to compile, draw()
+     * still works, one DrawMesh() per instance.
+     */
+    class InstancingShader {
+        public:
+            InstancingShader() = default;
+            ~InstancingShader();
+
+            InstancingShader(const InstancingShader &) = delete;
+            InstancingShader &operator=(const InstancingShader &) = delete;
+
+            void load();
+            void release();
+            std::size_t draw(const Model &model, const std::vector<Matrix> &transforms, Color tint) const;
+
+            [[nodiscard]] bool isLoaded() const { return _loaded; }
+
+        private:
+            Shader _shader{};
+            bool _loaded = false;
+    };
+} // namespace GUI
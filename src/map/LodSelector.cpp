@@ -0,0 +1,82 @@
+/**
+ * @file LodSelector.cpp
+ * @brief Implementation of the LodSelector class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the LodSelector class. Each
+ * threshold is moved away from the level a chunk is currently at, which is
+ * all the hysteresis takes.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** LodSelector.cpp
+*/
+
+#include "LodSelector.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Returns the distance from a point to a box
+ *
+ * @param box Axis-aligned box
+ * @param point Point in world space
+ * @return 0 if the point is inside the box
+ */
+static float distance_to(const BoundingBox &box, Vector3 point)
+{
+    const float dx = std::max({box.min.x - point.x, 0.0f, point.x - box.max.x});
+    const float dy = std::max({box.min.y - point.y, 0.0f, point.y - box.max.y});
+    const float dz = std::max({box.min.z - point.z, 0.0f, point.z - box.max.z});
+
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/**
+ * @brief Starts every chunk at the full detail level
+ *
+ * @param chunkCount Number of tile chunks of the map
+ */
+void GUI::LodSelector::reset(std::size_t chunkCount)
+{
+    _levels.assign(chunkCount, LOD_NEAR);
+    _previous.assign(chunkCount, LOD_NEAR);
+}
+
+/**
+ * @brief Updates the level of each chunk
+ *
+ * @param bounds Bounding box of each chunk
+ * @param visible One flag per chunk, 0 if the chunk is culled
+ * @param eye Camera position
+ */
+void GUI::LodSelector::update(const std::vector<BoundingBox> &bounds, const std::vector<std::uint8_t> &visible, Vector3 eye)
+{
+    static constexpr float THRESHOLDS[] = {MID_DISTANCE, FAR_DISTANCE};
+
+    if (_levels.size() != bounds.size())
+        reset(bounds.size());
+
+    for (std::size_t chunk = 0; chunk < bounds.size(); chunk++) {
+        if (visible[chunk] == 0) {
+            _levels[chunk] = LOD_CULLED;
+            continue;
+        }
+
+        const float distance = distance_to(bounds[chunk], eye);
+        const std::uint8_t current = _previous[chunk];
+        std::uint8_t level = LOD_NEAR;
+
+        for (float threshold : THRESHOLDS) {
+            const float shift = level < current ? 1.0f - HYSTERESIS : 1.0f + HYSTERESIS;
+            if (distance > threshold * shift)
+                level++;
+        }
+        _levels[chunk] = level;
+        _previous[chunk] = level;
+    }
+}
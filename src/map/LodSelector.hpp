@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** LodSelector.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+
+namespace GUI {
+
+    /**
+     * @brief Detail level a tile chunk is drawn at
+     *
+     * CULLED is 0 so that a level table doubles as a visibility mask.
+     */
+    enum Lod : std::uint8_t {
+        LOD_CULLED = 0,
+        LOD_NEAR = 1,     // full models
+        LOD_MID = 2,      // low-poly stand-ins
+        LOD_FAR = 3       // one flat marker per tile and resource type
+    };
+
+    static constexpr std::size_t LOD_COUNT = 4;
+
+    /**
+     * @brief Chooses the detail level of each tile chunk from its distance
+     *
+     * The distance is taken from the camera to the closest point of the
+     * chunk's bounding box. A chunk only moves to a coarser level once it is
+     * HYSTERESIS further than the threshold, and back once it is HYSTERESIS
+     * closer, so a camera resting near a threshold does not make it pop.
+     */
+    class LodSelector {
+        public:
+            static constexpr float MID_DISTANCE = 35.0f;
+            static constexpr float FAR_DISTANCE = 70.0f;
+            static constexpr float HYSTERESIS = 0.1f;    // fraction of the threshold
+
+            void reset(std::size_t chunkCount);
+            void update(const std::vector<BoundingBox> &bounds, const std::vector<std::uint8_t> &visible, Vector3 eye);
+
+            [[nodiscard]] const std::vector<std::uint8_t> &getLevels() const { return _levels; }
+
+        private:
+            std::vector<std::uint8_t> _levels;
+            std::vector<std::uint8_t> _previous;    // last level drawn, kept while culled
+    };
+} // namespace GUI
@@ -16,71 +16,172 @@
 ** map.cpp
 */
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
 #include <raylib.h>
+#include <raymath.h>
 #include "Map.hpp"
-#include <iostream>
+#include "../log/Logger.hpp"
 
 /**
  * @brief Constructs a new Map object
  *
- * Initializes the map with specified dimensions and tile size. Loads all 3D models
- * for game entities including eggs, players, resources, and food. The grid is
- * resized to match the specified width and height.
+ * Initializes the map with specified dimensions and tile size. Takes all 3D models
+ * for game entities including eggs, players, resources, and food from the asset
+ * cache, which reads each file once for the whole session; a model that failed
+ * to load, or is still loading in the background, is null and drawn with a
+ * fallback shape until it is ready (see adoptModels()). The grid is
+ * resized to match the specified width and height, and the ground meshes are
+ * built for that size (a Map is created again for each new map size).
+ * The bounding box of each tile chunk is computed here too, for culling,
+ * and the low-poly stand-ins and flat markers drawn at coarser detail
+ * levels are generated.
  *
+ * @param assets Cache the models are taken from
  * @param width The width of the map in tiles
  * @param height The height of the map in tiles
  * @param tileSize The size of each tile in world units
- *
- * @throws std::exception If any 3D model fails to load
  */
-GUI::Map::Map(std::size_t width, std::size_t height, float tileSize)
-    : _width(width), _height(height), _tileSize(tileSize)
+GUI::Map::Map(AssetCache &assets, std::size_t width, std::size_t height, float tileSize)
+    : _width(width), _height(height), _tileSize(tileSize), _assets(assets)
 {
     _grid.resize(width);
     for (auto &column : _grid)
         column.resize(height);
 
     try {
-        _playerModel = std::make_unique<raylib::Model>("assets/player.glb");
-        _eggModel = std::make_unique<raylib::Model>("assets/egg.glb");
-        _linemateModel = std::make_unique<raylib::Model>("assets/firstmineral.glb");
-        _deraumereModel = std::make_unique<raylib::Model>("assets/secondmineral.glb");
-        _siburModel = std::make_unique<raylib::Model>("assets/thirdmineral.glb");
-        _mendianeModel = std::make_unique<raylib::Model>("assets/fourthmineral.glb");
-        _phirasModel = std::make_unique<raylib::Model>("assets/fifthmineral.glb");
-        _thystameModel = std::make_unique<raylib::Model>("assets/sixthmineral.glb");
-        _foodModel = std::make_unique<raylib::Model>("assets/food.glb");
-
+        _resourceProxy = std::make_unique<raylib::Model>(GenMeshCube(1.0f, 1.0f, 1.0f));
+        _eggProxy = std::make_unique<raylib::Model>(GenMeshSphere(0.1f, 4, 6));
+        _playerProxy = std::make_unique<raylib::Model>(GenMeshCube(0.3f, 0.6f, 0.3f));
+        _playerMarker = std::make_unique<raylib::Model>(GenMeshPlane(0.4f, 0.4f, 1, 1));
+        _marker = std::make_unique<raylib::Model>(GenMeshPlane(1.0f, 1.0f, 1, 1));
     } catch (const std::exception& e) {
-        std::cerr << "Failed to load assets: " << e.what() << std::endl;
+        ZLOG_ERROR(Render, "Failed to build the level of detail meshes, models are drawn at full detail: %s", e.what());
+        _resourceProxy.reset();
+        _eggProxy.reset();
+        _playerProxy.reset();
+        _playerMarker.reset();
+        _marker.reset();
+    }
+
+    const int chunkSize = TileChunk::CHUNK_SIZE;
+    const int columns = static_cast<int>(width);
+    const int rows = static_cast<int>(height);
+    _chunksX = (columns + chunkSize - 1) / chunkSize;
+    for (int cy = 0; cy < rows; cy += chunkSize) {
+        for (int cx = 0; cx < columns; cx += chunkSize) {
+            const float x1 = static_cast<float>(std::min(cx + chunkSize, columns) - 1);
+            const float z1 = static_cast<float>(std::min(cy + chunkSize, rows) - 1);
+            _chunkBounds.push_back({
+                {(static_cast<float>(cx) - CHUNK_MARGIN) * tileSize, -GroundMesh::TILE_HEIGHT, (static_cast<float>(cy) - CHUNK_MARGIN) * tileSize},
+                {(x1 + CHUNK_MARGIN) * tileSize, CHUNK_TOP, (z1 + CHUNK_MARGIN) * tileSize}
+            });
+        }
+    }
+    _visibleChunks.assign(_chunkBounds.size(), 1);
+    _lod.reset(_chunkBounds.size());
+
+    _ground.build(columns, rows, tileSize);
+    _instancing.load();
+    adoptModels();
+}
+
+/**
+ * @brief Takes the models from the asset cache again
+ *
+ * Called when the cache's model revision changed, i.e. a model preloaded
+ * in the background became available. The instance transforms fold the
+ * resource and player base transforms in, so they are rebuilt from the
+ * current snapshot, but only if one of those models actually changed.
+ */
+void GUI::Map::adoptModels()
+{
+    static const std::pair<AssetCache::ModelHandle Map::*, const char *> files[] = {
+        {&Map::_playerModel, "assets/player.glb"},
+        {&Map::_eggModel, "assets/egg.glb"},
+        {&Map::_linemateModel, "assets/firstmineral.glb"},
+        {&Map::_deraumereModel, "assets/secondmineral.glb"},
+        {&Map::_siburModel, "assets/thirdmineral.glb"},
+        {&Map::_mendianeModel, "assets/fourthmineral.glb"},
+        {&Map::_phirasModel, "assets/fifthmineral.glb"},
+        {&Map::_thystameModel, "assets/sixthmineral.glb"},
+        {&Map::_foodModel, "assets/food.glb"}
+    };
+    bool changed = false;
+
+    _modelRevision = _assets.getModelRevision();
+    for (const auto &[member, path] : files) {
+        AssetCache::ModelHandle model = _assets.getModel(path);
+        if (model == this->*member)
+            continue;
+        this->*member = std::move(model);
+        if (member != &Map::_eggModel)
+            changed = true;
     }
+    if (!changed)
+        return;
+
+    for (std::size_t i = 0; i < TileStore::RESOURCE_COUNT; ++i)
+        _resources.setModel(i, getResourceModel(i));
+    _players.setModel(_playerModel.get());
+    if (_snapshot != nullptr)
+        rebuild();
+}
+
+/**
+ * @brief Returns the model of a resource
+ *
+ * @param resource Resource index (food, then the six stones)
+ * @return The model, or nullptr if it failed to load
+ */
+const raylib::Model *GUI::Map::getResourceModel(std::size_t resource) const
+{
+    const AssetCache::ModelHandle *models[] = {
+        &_foodModel,
+        &_linemateModel,
+        &_deraumereModel,
+        &_siburModel,
+        &_mendianeModel,
+        &_phirasModel,
+        &_thystameModel
+    };
+
+    return resource < TileStore::RESOURCE_COUNT ? models[resource]->get() : nullptr;
+}
+
+/**
+ * @brief Returns the number of draw calls a model draw issues
+ *
+ * @param model Model, or nullptr when a fallback shape is drawn instead
+ * @return One per mesh of the model, or 1 for a fallback shape
+ */
+static std::size_t draw_calls(const raylib::Model *model)
+{
+    return model != nullptr ? static_cast<std::size_t>(model->meshCount) : 1;
 }
 
 /**
  * @brief Draws the ground tiles of the map
  *
- * Renders a checkered pattern of ground tiles using cubes. Each tile alternates
- * between GREEN and DARKGREEN colors to create a visual grid pattern. White
- * wireframes are drawn around each tile for better visibility.
+ * Renders a checkered pattern of ground tiles alternating between GREEN and
+ * DARKGREEN, with white grid lines between them. Each tile has a height of
+ * 0.1 world units.
  *
- * The tiles are positioned based on their grid coordinates multiplied by the tile size.
- * Each tile has a height of 0.1 world units.
+ * The ground is baked into one static mesh per chunk of tiles when the map
+ * is created (see GroundMesh), so this costs one draw call per chunk
+ * instead of two immediate-mode cubes per tile, and culled chunks are
+ * skipped.
  */
 void GUI::Map::drawGround()
 {
-    for (std::size_t x = 0; x < _width; ++x) {
-        for (std::size_t y = 0; y < _height; ++y) {
-            Vector3 position = { static_cast<float>(x) * _tileSize, 0.0f, static_cast<float>(y) * _tileSize };
-            DrawCube(position, _tileSize, 0.1f, _tileSize, (x + y) % 2 == 0 ? GREEN : DARKGREEN);
-            DrawCubeWires(position, _tileSize, 0.1f, _tileSize, WHITE);
-        }
-    }
+    _renderStats.ground = _ground.draw(_visibleChunks);
 }
 
 /**
  * @brief Draws all resources on the map
  *
- * Renders resources on each tile based on the stored tile data. Resources are
+ * Resources are
  * represented by 3D models when available, or fallback to colored spheres.
  * Multiple instances of the same resource are positioned in a grid pattern
  * on the tile with slight offsets to avoid overlap.
@@ -95,19 +196,15 @@ void GUI::Map::drawGround()
  * - Thystame (PINK)
  *
  * Each resource type can have up to 5 instances displayed per tile.
+ * The transforms of every instance are kept by ResourceInstances, updated
+ * by sync() for the chunks that changed only, and each model is drawn with
+ * one instanced call per mesh whatever the number of tiles. The colors
+ * above are those of the fallback spheres, whose radius is stored in the
+ * instance transform, and of the cubes and flat markers drawn instead of
+ * the models in chunks at the middle and far detail levels (see cull()).
  */
 void GUI::Map::drawResources()
 {
-    raylib::Model* resourceModels[] = {
-        _foodModel.get(),
-        _linemateModel.get(),
-        _deraumereModel.get(),
-        _siburModel.get(),
-        _mendianeModel.get(),
-        _phirasModel.get(),
-        _thystameModel.get()
-    };
-
     const Color resourceColors[] = {
         YELLOW,
         BLUE,
@@ -118,37 +215,29 @@ void GUI::Map::drawResources()
         PINK
     };
 
-    for (const auto& [pos, tile] : _tileData) {
-        int x = pos.first;
-        int y = pos.second;
-        Vector3 basePos = { static_cast<float>(x) * _tileSize, 0.1f, static_cast<float>(y) * _tileSize };
-
-        for (size_t i = 0; i < tile.resources.size() && i < 7; ++i) {
-            int resourceCount = tile.resources[i];
-            if (resourceCount > 0) {
-                for (int count = 0; count < resourceCount && count < 5; ++count) {
-                    Vector3 resourcePos = {
-                        basePos.x + ((count % 3) - 1) * 0.15f + ((i % 2) * 0.1f),
-                        basePos.y + 0.05f,
-                        basePos.z + ((count / 3) - 1) * 0.15f + ((i / 2) * 0.1f)
-                    };
-
-                    if (resourceModels[i] != nullptr) {
-                        try {
-                            resourceModels[i]->Draw(resourcePos, 0.1f, WHITE);
-                        } catch (const std::exception& e) {
-                            float size = 0.05f + (resourceCount * 0.02f);
-                            if (size > 0.2f) size = 0.2f;
-                            DrawSphere(resourcePos, size, resourceColors[i]);
-                        }
-                    } else {
-                        float size = 0.05f + (resourceCount * 0.02f);
-                        if (size > 0.2f) size = 0.2f;
-                        DrawSphere(resourcePos, size, resourceColors[i]);
-                    }
-                }
-            }
+    if (_snapshot == nullptr)
+        return;
+
+    for (std::size_t i = 0; i < TileStore::RESOURCE_COUNT; ++i) {
+        const std::vector<Matrix> &near = _resources.getTransforms(LOD_NEAR, i);
+        const std::vector<Matrix> &mid = _resources.getTransforms(LOD_MID, i);
+        const std::vector<Matrix> &far = _resources.getTransforms(LOD_FAR, i);
+        const raylib::Model *model = getResourceModel(i);
+
+        _renderStats.resourceInstances[LOD_NEAR] += near.size();
+        _renderStats.resourceInstances[LOD_MID] += mid.size();
+        _renderStats.resourceInstances[LOD_FAR] += far.size();
+        if (_resourceProxy) {
+            _renderStats.resources += _instancing.draw(*_resourceProxy, mid, resourceColors[i]);
+            _renderStats.resources += _instancing.draw(*_marker, far, resourceColors[i]);
+        }
+        if (model != nullptr) {
+            _renderStats.resources += _instancing.draw(*model, near, WHITE);
+            continue;
         }
+        for (const Matrix &transform : near)
+            DrawSphere({transform.m12, transform.m13, transform.m14}, transform.m0, resourceColors[i]);
+        _renderStats.resources += near.size();
     }
 }
 
@@ -160,22 +249,52 @@ void GUI::Map::drawResources()
  * and scaled to a small size (0.005f) to maintain proper proportions.
  *
  * Each egg is identified by a unique ID and has specific x, y coordinates
- * stored in the _eggData map.
+ * stored in the world. Eggs in culled chunks are skipped; in chunks at the
+ * middle and far detail levels, they are gathered and drawn as low-poly
+ * spheres or flat markers, one instanced call for each.
  */
 void GUI::Map::drawEggs()
 {
-    for (const auto& [id, egg] : _eggData) {
+    if (_snapshot == nullptr)
+        return;
+
+    for (std::vector<Matrix> &transforms : _eggTransforms)
+        transforms.clear();
+
+    _snapshot->forEachEgg([&](const EggInfo &egg) {
+        const std::size_t chunk = static_cast<std::size_t>((egg.y / TileChunk::CHUNK_SIZE) * _chunksX + egg.x / TileChunk::CHUNK_SIZE);
+        const std::uint8_t level = chunk < _chunkLevels.size() ? _chunkLevels[chunk] : static_cast<std::uint8_t>(LOD_NEAR);
+        if (level == LOD_CULLED)
+            return;
+
         Vector3 eggPos = {
             static_cast<float>(egg.x) * _tileSize,
             0.0f,
             static_cast<float>(egg.y) * _tileSize
         };
 
+        _renderStats.eggInstances[level]++;
+        if (level == LOD_MID) {
+            _eggTransforms[level].push_back(MatrixTranslate(eggPos.x, 0.1f, eggPos.z));
+            return;
+        }
+        if (level == LOD_FAR) {
+            _eggTransforms[level].push_back(MatrixMultiply(MatrixScale(0.2f * _tileSize, 1.0f, 0.2f * _tileSize),
+                MatrixTranslate(eggPos.x, ResourceInstances::MARKER_HEIGHT, eggPos.z)));
+            return;
+        }
+
+        _renderStats.eggs += draw_calls(_eggModel.get());
         if (_eggModel) {
             _eggModel->Draw(eggPos, 0.005f, WHITE);
         } else {
             DrawSphere(eggPos, 0.1f, BEIGE);
         }
+    });
+
+    if (_eggProxy) {
+        _renderStats.eggs += _instancing.draw(*_eggProxy, _eggTransforms[LOD_MID], BEIGE);
+        _renderStats.eggs += _instancing.draw(*_marker, _eggTransforms[LOD_FAR], BEIGE);
     }
 }
 
@@ -183,49 +302,48 @@ void GUI::Map::drawEggs()
  * @brief Draws all players on the map
  *
  * Renders players with team-specific colors and proper orientation.
- * Each team is assigned a unique color from a predefined palette.
- * Players are positioned at y = 0.3f to appear above the ground.
+ * The color of each team is prepared once when the team is registered (see
+ * prepareTeams()), so drawing a player is an array read by team index.
+ * Players are positioned at y = 0.3f to appear above the ground. Players
+ * sharing a tile are spread around its center by their stack index, and
+ * players taking part in an incantation stand in a gold ring.
  *
- * Player orientation is handled as follows:
- * - 1: North (180 degrees)
- * - 2: East (90 degrees)
- * - 3: South (0 degrees)
- * - 4: West (270 degrees)
- *
- * The function supports up to 8 different team colors:
- * RED, BLUE, GREEN, YELLOW, PURPLE, ORANGE, PINK, BROWN
+ * The transforms of every player are kept by PlayerInstances, per team,
+ * updated by sync() for the player pages that changed only. Each team is
+ * drawn with one instanced call per mesh of the player model, tinted with
+ * the team color, whatever the number of players; players in chunks at
+ * the middle and far detail levels are drawn as team-colored boxes or flat
+ * markers instead.
  */
 void GUI::Map::drawPlayers()
 {
-    const Color teamColors[] = {
-        RED, BLUE, GREEN, YELLOW, PURPLE, ORANGE, PINK, BROWN
-    };
-
-    int teamIndex = 0;
-    std::map<std::string, int> teamColorMap;
-
-    for (const auto& [id, player] : _playerData) {
-        if (teamColorMap.find(player.getTeam()) == teamColorMap.end()) {
-            teamColorMap[player.getTeam()] = teamIndex % 8;
-            teamIndex++;
+    if (_snapshot == nullptr)
+        return;
+
+    for (const Vector3 &ring : _players.getRings())
+        DrawCircle3D(ring, 0.2f * _tileSize, {1, 0, 0}, 90.0f, GOLD);
+    _renderStats.players += _players.getRings().size();
+
+    for (std::size_t team = 0; team < _players.getTeamCount(); team++) {
+        const std::vector<Matrix> &transforms = _players.getTransforms(LOD_NEAR, team);
+        const std::vector<Matrix> &mid = _players.getTransforms(LOD_MID, team);
+        const std::vector<Matrix> &far = _players.getTransforms(LOD_FAR, team);
+        const Color playerColor = team < _teamTints.size() ? _teamTints[team] : WHITE;
+
+        _renderStats.playerInstances[LOD_NEAR] += transforms.size();
+        _renderStats.playerInstances[LOD_MID] += mid.size();
+        _renderStats.playerInstances[LOD_FAR] += far.size();
+        if (_playerProxy) {
+            _renderStats.players += _instancing.draw(*_playerProxy, mid, playerColor);
+            _renderStats.players += _instancing.draw(*_playerMarker, far, playerColor);
         }
-
-        Vector3 playerPos = {
-            static_cast<float>(player.getX()) * _tileSize,
-            0.3f,
-            static_cast<float>(player.getY()) * _tileSize
-        };
-
-        Color playerColor = teamColors[teamColorMap[player.getTeam()]];
-
-        float orientationDegree;
-        switch (player.getOrientation()) {
-            case 1: orientationDegree = 180.0F; break; // North
-            case 2: orientationDegree = 90.0F; break; // East
-            case 3: orientationDegree = 0.0F; break; // South
-            case 4: orientationDegree = 270.0F; break; // West
+        if (_playerModel) {
+            _renderStats.players += _instancing.draw(*_playerModel, transforms, playerColor);
+            continue;
         }
-        _playerModel->Draw(playerPos, {0, 1, 0}, orientationDegree, {1.0F, 1.0F, 1.0F}, playerColor);
+        for (const Matrix &transform : transforms)
+            DrawSphere({transform.m12, transform.m13, transform.m14}, 0.2f, playerColor);
+        _renderStats.players += transforms.size();
     }
 }
 
@@ -239,7 +357,7 @@ void GUI::Map::drawPlayers()
  * - A triangular pointer pointing to the player
  * - The message text centered in the bubble
  *
- * Messages are automatically cleared when they expire. The bubble size
+ * Messages are no longer shown once they expire. The bubble size
  * adapts to the message length, and the position is calculated using
  * world-to-screen conversion.
  *
@@ -247,19 +365,24 @@ void GUI::Map::drawPlayers()
  */
 void GUI::Map::drawBroadcastMessages(const Camera3D& camera)
 {
-    for (auto& [id, player] : _playerData) {
-        const_cast<Player&>(player).clearBroadcastIfExpired();
+    if (_snapshot == nullptr)
+        return;
+
+    const auto now = std::chrono::steady_clock::now();
+    _snapshot->forEachPlayerPage([&](const PlayerColumns &players) {
+        for (std::size_t row = 0; row < players.size(); row++) {
+            if (!players.showsBroadcast(row, now))
+                continue;
 
-        if (player.shouldShowBroadcast()) {
             Vector3 playerPos = {
-                static_cast<float>(player.getX()) * _tileSize,
+                static_cast<float>(players.x[row]) * _tileSize,
                 0.8f,
-                static_cast<float>(player.getY()) * _tileSize
+                static_cast<float>(players.y[row]) * _tileSize
             };
 
             Vector2 screenPos = GetWorldToScreen(playerPos, camera);
 
-            const std::string &message = player.getBroadcastMessage();
+            const std::string &message = _snapshot->getString(players.broadcast[row]);
 
             int textWidth = MeasureText(message.c_str(), 16);
             int bubbleWidth = textWidth + 20;
@@ -291,49 +414,116 @@ void GUI::Map::drawBroadcastMessages(const Camera3D& camera)
 
             DrawText(message.c_str(), static_cast<int>(textPos.x), static_cast<int>(textPos.y), 16, BLACK);
         }
-    }
+    });
 }
 
 /**
- * @brief Updates the tile data for the map
+ * @brief Brings the map's caches up to date with a world snapshot
  *
- * Replaces the current tile data with new information. This includes
- * resource counts and other tile-specific information that affects
- * how resources are rendered on the map.
+ * Keeps a reference to the snapshot, which is what the map renders until
+ * the next sync. Snapshots share unchanged tile chunks, so only the chunks
+ * whose pointer differs from the previous snapshot are re-examined; the
+ * first snapshot, or one from a new epoch (msz received again), rebuilds
+ * everything. Nothing is done if the snapshot did not change.
+ * The resource instances of a changed chunk are rebuilt from that chunk,
+ * and the player instances of a changed player page from that page.
  *
- * @param tiles A map containing tile positions as keys and TileInfo as values
+ * @param snapshot Latest snapshot published by the ingest thread
  */
-void GUI::Map::updateTileData(const std::map<std::pair<int, int>, TileInfo>& tiles)
+void GUI::Map::sync(std::shared_ptr<const WorldSnapshot> snapshot)
 {
-    _tileData = tiles;
+    if (snapshot == nullptr || snapshot == _snapshot)
+        return;
+
+    std::shared_ptr<const WorldSnapshot> previous = std::move(_snapshot);
+    _snapshot = std::move(snapshot);
+
+    if (previous == nullptr || previous->getEpoch() != _snapshot->getEpoch()) {
+        rebuild();
+        return;
+    }
+    for (std::size_t chunk = 0; chunk < _snapshot->getChunkCount(); ++chunk) {
+        if (_snapshot->getChunk(chunk) != previous->getChunk(chunk))
+            _resources.rebuildChunk(*_snapshot, chunk, _tileSize);
+    }
+    _players.resize(_snapshot->getPlayerPageCount());
+    for (std::size_t page = 0; page < _snapshot->getPlayerPageCount(); ++page) {
+        if (page >= previous->getPlayerPageCount() || _snapshot->getPlayerPage(page) != previous->getPlayerPage(page))
+            _players.rebuildPage(*_snapshot, page, _tileSize);
+    }
+    prepareTeams();
 }
 
 /**
- * @brief Updates the player data for the map
- *
- * Replaces the current player data with new information. This includes
- * player positions, orientations, teams, and other player-specific data
- * that affects how players are rendered on the map.
+ * @brief Rebuilds every cache from the current snapshot
+ */
+void GUI::Map::rebuild()
+{
+    _resources.reset(_snapshot->getChunkCount());
+    for (std::size_t chunk = 0; chunk < _snapshot->getChunkCount(); ++chunk)
+        _resources.rebuildChunk(*_snapshot, chunk, _tileSize);
+    _players.reset(_snapshot->getPlayerPageCount());
+    for (std::size_t page = 0; page < _snapshot->getPlayerPageCount(); ++page)
+        _players.rebuildPage(*_snapshot, page, _tileSize);
+
+    _teamTints.clear();
+    prepareTeams();
+}
+
+/**
+ * @brief Prepares the render attributes of newly registered teams
  *
- * @param players An unordered map containing player IDs as keys and Player objects as values
+ * Teams get palette entries by registry index, so a team keeps its color for
+ * the whole game whatever the order its players appear in. The palette has
+ * 8 colors: RED, BLUE, GREEN, YELLOW, PURPLE, ORANGE, PINK, BROWN.
  */
-void GUI::Map::updatePlayerData(const std::unordered_map<std::string, Player>& players)
+void GUI::Map::prepareTeams()
 {
-    _playerData = players;
+    static const Color palette[] = {
+        RED, BLUE, GREEN, YELLOW, PURPLE, ORANGE, PINK, BROWN
+    };
+
+    const std::size_t count = _snapshot->getTeams().size();
+    while (_teamTints.size() < count)
+        _teamTints.push_back(palette[_teamTints.size() % 8]);
 }
 
 /**
- * @brief Updates the egg data for the map
+ * @brief Flags the tile chunks the camera can see and picks their detail level
  *
- * Replaces the current egg data with new information. This includes
- * egg positions and other egg-specific data that affects how eggs
- * are rendered on the map.
+ * Each chunk's bounding box is tested against the camera frustum, then the
+ * visible chunks get a detail level from their distance to the camera (see
+ * LodSelector); without the stand-in meshes every visible chunk stays at
+ * LOD_NEAR. The levels are handed to the resource instances, which move
+ * only the chunks whose level changed, and to the player instances, which
+ * join their arrays again only when a level changed.
  *
- * @param eggs An unordered map containing egg IDs as keys and EggInfo objects as values
+ * @param camera The camera the map is drawn with
  */
-void GUI::Map::updateEggData(const std::unordered_map<std::string, EggInfo>& eggs)
+void GUI::Map::cull(const Camera3D &camera)
 {
-    _eggData = eggs;
+    const int screenWidth = GetScreenWidth();
+    const int screenHeight = GetScreenHeight();
+    const float aspect = screenHeight > 0 ? static_cast<float>(screenWidth) / static_cast<float>(screenHeight) : 1.0f;
+    const Frustum frustum = Frustum::fromCamera(camera, aspect);
+
+    for (std::size_t chunk = 0; chunk < _chunkBounds.size(); ++chunk) {
+        const bool visible = frustum.intersects(_chunkBounds[chunk]);
+        _visibleChunks[chunk] = visible ? 1 : 0;
+        if (visible)
+            _renderStats.visibleChunks++;
+        else
+            _renderStats.culledChunks++;
+    }
+
+    if (_resourceProxy) {
+        _lod.update(_chunkBounds, _visibleChunks, camera.position);
+        _chunkLevels = _lod.getLevels();
+    } else {
+        _chunkLevels = _visibleChunks;
+    }
+    _resources.setLevels(_chunkLevels);
+    _players.setLevels(_chunkLevels);
 }
 
 /**
@@ -345,10 +535,21 @@ void GUI::Map::updateEggData(const std::unordered_map<std::string, EggInfo>& egg
  * 3. Eggs (game entities)
  * 4. Players (top layer for visibility)
  *
+ * Only the tile chunks inside the camera frustum contribute to each layer
+ * (see cull()). The draw calls of each layer and the visible and culled
+ * chunk counts are reported in getRenderStats(). Models the asset cache
+ * finished since the last frame replace their fallback shapes first.
+ *
  * This method should be called during the 3D rendering phase of the game loop.
+ *
+ * @param camera The camera the map is drawn with
  */
-void GUI::Map::render()
+void GUI::Map::render(const Camera3D &camera)
 {
+    if (_assets.getModelRevision() != _modelRevision)
+        adoptModels();
+    _renderStats = RenderStats{};
+    cull(camera);
     drawGround();
     drawResources();
     drawEggs();
@@ -7,53 +7,109 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <memory>
-#include <unordered_map>
+#include <cstdint>
 #include "../core/Core.hpp"
+#include "../assets/AssetCache.hpp"
+#include "Frustum.hpp"
+#include "GroundMesh.hpp"
+#include "InstancingShader.hpp"
+#include "LodSelector.hpp"
+#include "PlayerInstances.hpp"
+#include "ResourceInstances.hpp"
 
 namespace GUI {
-    struct TileInfo;
-    struct PlayerInfo;
-    struct EggInfo;
+
+    /**
+     * @brief Draw calls issued by the last Map::render(), per layer
+     *
+     * A model counts one draw call per mesh. The chunk counts tell how many
+     * tile chunks passed the frustum test, and the instance counts how many
+     * resources (markers at LOD_FAR), eggs and players were drawn at each
+     * detail level; they are not draw calls.
+     */
+    struct RenderStats {
+        std::size_t ground = 0;
+        std::size_t resources = 0;
+        std::size_t eggs = 0;
+        std::size_t players = 0;
+        std::size_t visibleChunks = 0;
+        std::size_t culledChunks = 0;
+        std::array<std::size_t, LOD_COUNT> resourceInstances{};
+        std::array<std::size_t, LOD_COUNT> eggInstances{};
+        std::array<std::size_t, LOD_COUNT> playerInstances{};
+
+        [[nodiscard]] std::size_t total() const { return ground + resources + eggs + players; }
+    };
 
     class Map {
 
         private:
+            static constexpr float CHUNK_MARGIN = 0.75f;    // in tiles, covers the models overhanging a tile
+            static constexpr float CHUNK_TOP = 2.0f;
+
             std::size_t _width;
             std::size_t _height;
             float _tileSize;
             std::vector<std::vector<int>> _grid;
 
-            std::unique_ptr<raylib::Model> _eggModel;
-            std::unique_ptr<raylib::Model> _playerModel;
-            std::unique_ptr<raylib::Model> _foodModel;
-            std::unique_ptr<raylib::Model> _linemateModel;
-            std::unique_ptr<raylib::Model> _deraumereModel;
-            std::unique_ptr<raylib::Model> _siburModel;
-            std::unique_ptr<raylib::Model> _mendianeModel;
-            std::unique_ptr<raylib::Model> _phirasModel;
-            std::unique_ptr<raylib::Model> _thystameModel;
+            AssetCache &_assets;
+            std::uint64_t _modelRevision = 0;
+            AssetCache::ModelHandle _eggModel;
+            AssetCache::ModelHandle _playerModel;
+            AssetCache::ModelHandle _foodModel;
+            AssetCache::ModelHandle _linemateModel;
+            AssetCache::ModelHandle _deraumereModel;
+            AssetCache::ModelHandle _siburModel;
+            AssetCache::ModelHandle _mendianeModel;
+            AssetCache::ModelHandle _phirasModel;
+            AssetCache::ModelHandle _thystameModel;
+
+            std::unique_ptr<raylib::Model> _resourceProxy;
+            std::unique_ptr<raylib::Model> _eggProxy;
+            std::unique_ptr<raylib::Model> _playerProxy;
+            std::unique_ptr<raylib::Model> _playerMarker;
+            std::unique_ptr<raylib::Model> _marker;
+
+            std::shared_ptr<const WorldSnapshot> _snapshot;
+
+            std::vector<Color> _teamTints;
+
+            int _chunksX;
+            std::vector<BoundingBox> _chunkBounds;
+            std::vector<std::uint8_t> _visibleChunks;
+            LodSelector _lod;
+            std::vector<std::uint8_t> _chunkLevels;
+            std::array<std::vector<Matrix>, LOD_COUNT> _eggTransforms;
 
-            std::map<std::pair<int, int>, GUI::TileInfo> _tileData;
-            std::unordered_map<std::string, GUI::Player> _playerData;
-            std::unordered_map<std::string, GUI::EggInfo> _eggData;
+            GroundMesh _ground;
+            InstancingShader _instancing;
+            ResourceInstances _resources;
+            PlayerInstances _players;
+            RenderStats _renderStats;
 
+            void adoptModels();
+            void rebuild();
+            [[nodiscard]] const raylib::Model *getResourceModel(std::size_t resource) const;
+            void prepareTeams();
+            void cull(const Camera3D &camera);
             void drawGround();
             void drawResources();
             void drawEggs();
             void drawPlayers();
 
         public:
-            Map(std::size_t width, std::size_t height, float tileSize = 1.0f);
+            Map(AssetCache &assets, std::size_t width, std::size_t height, float tileSize = 1.0f);
             ~Map() = default;
 
             std::size_t get_width() const { return _width; }
             std::size_t get_height() const { return _height; }
-            void updateTileData(const std::map<std::pair<int, int>, GUI::TileInfo>& tiles);
-            void updatePlayerData(const std::unordered_map<std::string, GUI::Player>& players);
-            void updateEggData(const std::unordered_map<std::string, GUI::EggInfo>& eggs);
-            void render();
+            void sync(std::shared_ptr<const WorldSnapshot> snapshot);
+            void render(const Camera3D &camera);
+            [[nodiscard]] const RenderStats &getRenderStats() const { return _renderStats; }
+            [[nodiscard]] const GroundMesh &getGround() const { return _ground; }
             void renderUI(const Camera3D &camera);
             void drawBroadcastMessages(const Camera3D& camera);
     };
@@ -0,0 +1,245 @@
+/**
+ * @file PlayerInstances.cpp
+ * @brief Implementation of the PlayerInstances class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the PlayerInstances class. A
+ * page is rebuilt from the position, stack, flag, team and orientation
+ * columns of its PlayerColumns, and only the teams whose arrays or chunk
+ * levels changed are joined again before the next draw.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** PlayerInstances.cpp
+*/
+
+#include "PlayerInstances.hpp"
+#include <algorithm>
+#include <raymath.h>
+
+/**
+ * @brief Returns where a stacked player stands relative to its tile center
+ *
+ * The first player stands on the center, the next eight around it; further
+ * players start over, so a crowded tile stays readable.
+ *
+ * @param stackIndex Rank of the player on its tile
+ * @return Offset in tiles
+ */
+static Vector2 stack_offset(int stackIndex)
+{
+    static constexpr float STEP = 0.25f;
+    static constexpr int SPOTS[9][2] = {
+        {0, 0}, {-1, -1}, {1, 1}, {1, -1}, {-1, 1}, {0, -1}, {0, 1}, {-1, 0}, {1, 0}
+    };
+    const int *spot = SPOTS[stackIndex % 9];
+
+    return {static_cast<float>(spot[0]) * STEP, static_cast<float>(spot[1]) * STEP};
+}
+
+/**
+ * @brief Returns the rotation of a player around the vertical axis
+ *
+ * - 1: North (180 degrees)
+ * - 2: East (90 degrees)
+ * - 3: South (0 degrees)
+ * - 4: West (270 degrees)
+ *
+ * @param orientation Orientation sent by the server
+ * @return Angle in degrees
+ */
+static float orientation_degrees(int orientation)
+{
+    switch (orientation) {
+        case 1: return 180.0F;
+        case 2: return 90.0F;
+        case 4: return 270.0F;
+        default: return 0.0F;
+    }
+}
+
+/**
+ * @brief Sets the model drawn for players at the near level
+ *
+ * @param model Player model, or nullptr if none is drawn
+ */
+void GUI::PlayerInstances::setModel(const Model *model)
+{
+    _base = model != nullptr ? model->transform : MatrixIdentity();
+}
+
+/**
+ * @brief Drops every transform and sizes the page table
+ *
+ * @param pageCount Number of player pages of the snapshots
+ */
+void GUI::PlayerInstances::reset(std::size_t pageCount)
+{
+    _pages.clear();
+    for (auto &teams : _joined)
+        teams.clear();
+    _dirty.clear();
+    _rings.clear();
+    _ringsDirty = false;
+    resize(pageCount);
+}
+
+/**
+ * @brief Follows a change in the number of player pages
+ *
+ * Pages dropped at the end mark the teams they held for joining again.
+ *
+ * @param pageCount Number of player pages of the current snapshot
+ */
+void GUI::PlayerInstances::resize(std::size_t pageCount)
+{
+    for (std::size_t page = pageCount; page < _pages.size(); page++) {
+        const Batch &batch = _pages[page];
+        for (std::size_t team = 0; team < batch.teams.size(); team++) {
+            if (!batch.teams[team].empty())
+                _dirty[team] = 1;
+        }
+        if (!batch.rings.empty())
+            _ringsDirty = true;
+    }
+    _pages.resize(pageCount);
+}
+
+/**
+ * @brief Recomputes the transforms of one page
+ *
+ * @param snapshot Snapshot holding the page
+ * @param page Page index in the snapshot
+ * @param tileSize Size of a tile in world units
+ */
+void GUI::PlayerInstances::rebuildPage(const WorldSnapshot &snapshot, std::size_t page, float tileSize)
+{
+    const PlayerColumns &players = *snapshot.getPlayerPage(page);
+    const std::uint32_t chunksX = static_cast<std::uint32_t>(snapshot.getChunksX());
+    Batch &batch = _pages[page];
+
+    for (std::size_t team = 0; team < batch.teams.size(); team++) {
+        if (!batch.teams[team].empty()) {
+            batch.teams[team].clear();
+            batch.teamChunks[team].clear();
+            _dirty[team] = 1;
+        }
+    }
+    if (!batch.rings.empty()) {
+        batch.rings.clear();
+        batch.ringChunks.clear();
+        _ringsDirty = true;
+    }
+
+    for (std::size_t row = 0; row < players.size(); row++) {
+        const std::size_t team = players.team[row];
+        const Vector2 offset = stack_offset(players.stack[row]);
+        const float x = (static_cast<float>(players.x[row]) + offset.x) * tileSize;
+        const float z = (static_cast<float>(players.y[row]) + offset.y) * tileSize;
+        const std::uint32_t chunk = static_cast<std::uint32_t>(players.y[row] / TileChunk::CHUNK_SIZE) * chunksX
+            + static_cast<std::uint32_t>(players.x[row] / TileChunk::CHUNK_SIZE);
+
+        if (team >= batch.teams.size()) {
+            batch.teams.resize(team + 1);
+            batch.teamChunks.resize(team + 1);
+        }
+        if (team >= _dirty.size()) {
+            for (auto &teams : _joined)
+                teams.resize(team + 1);
+            _dirty.resize(team + 1, 0);
+        }
+        const Matrix rotation = MatrixRotateY(orientation_degrees(players.orientation[row]) * DEG2RAD);
+        batch.teams[team].push_back(MatrixMultiply(rotation, MatrixTranslate(x, HEIGHT, z)));
+        batch.teamChunks[team].push_back(chunk);
+        _dirty[team] = 1;
+
+        if (players.has(row, PlayerColumns::INCANTING)) {
+            batch.rings.push_back({x, 0.05f, z});
+            batch.ringChunks.push_back(chunk);
+            _ringsDirty = true;
+        }
+    }
+}
+
+/**
+ * @brief Sets the detail level of each chunk
+ *
+ * The arrays are joined again only if some chunk changed level.
+ *
+ * @param levels One Lod per chunk, LOD_CULLED if the chunk is not drawn;
+ *        chunks past its end are drawn at LOD_NEAR
+ */
+void GUI::PlayerInstances::setLevels(const std::vector<std::uint8_t> &levels)
+{
+    if (levels == _levels)
+        return;
+    _levels = levels;
+    std::fill(_dirty.begin(), _dirty.end(), 1);
+    _ringsDirty = true;
+}
+
+/**
+ * @brief Joins the arrays of every page for one team, by level
+ *
+ * The model transform is folded into the near matrices here, so that a
+ * chunk going back and forth between levels does not rebuild its pages.
+ *
+ * @param team Team index in the registry
+ */
+void GUI::PlayerInstances::join(std::size_t team)
+{
+    for (auto &teams : _joined)
+        teams[team].clear();
+
+    for (const Batch &batch : _pages) {
+        if (team >= batch.teams.size())
+            continue;
+        for (std::size_t i = 0; i < batch.teams[team].size(); i++) {
+            const std::uint8_t level = levelOf(batch.teamChunks[team][i]);
+            const Matrix &placement = batch.teams[team][i];
+
+            if (level != LOD_CULLED)
+                _joined[level][team].push_back(level == LOD_NEAR ? MatrixMultiply(_base, placement) : placement);
+        }
+    }
+    _dirty[team] = 0;
+}
+
+/**
+ * @brief Returns the transforms of the players of a team drawn at a level
+ *
+ * The per-page arrays are joined again only if one of them, or the level
+ * of some chunk, changed since the last call.
+ *
+ * @param lod Detail level
+ * @param team Team index in the registry
+ * @return One world transform per player
+ */
+const std::vector<Matrix> &GUI::PlayerInstances::getTransforms(Lod lod, std::size_t team)
+{
+    if (_dirty[team] != 0)
+        join(team);
+    return _joined[lod][team];
+}
+
+/**
+ * @brief Returns the centers of the visible incantation rings
+ */
+const std::vector<Vector3> &GUI::PlayerInstances::getRings()
+{
+    if (_ringsDirty) {
+        _rings.clear();
+        for (const Batch &batch : _pages) {
+            for (std::size_t i = 0; i < batch.rings.size(); i++) {
+                if (levelOf(batch.ringChunks[i]) != LOD_CULLED)
+                    _rings.push_back(batch.rings[i]);
+            }
+        }
+        _ringsDirty = false;
+    }
+    return _rings;
+}
@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** PlayerInstances.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "LodSelector.hpp"
+#include "../world/WorldSnapshot.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Transforms of the players drawn on the map, by team
+     *
+     * Transforms are kept per player page of the snapshots and per team, so
+     * a page that changed (a player on it moved, turned, joined or left) is
+     * rebuilt alone; the arrays of every page are then joined into one array
+     * per detail level and team, which InstancingShader draws in one call
+     * per mesh with the team color. The centers of the incantation rings are
+     * kept the same way. Each entry remembers the tile chunk it stands in:
+     * it is joined into the array of that chunk's level, as given by the
+     * last setLevels(), and left out if the chunk is culled.
+     *
+     * Each matrix holds the orientation and the position of the player,
+     * spread around its tile by its stack rank; near matrices also hold the
+     * model transform.
+     */
+    class PlayerInstances {
+        public:
+            static constexpr float HEIGHT = 0.3f;
+
+            void setModel(const Model *model);
+            void reset(std::size_t pageCount);
+            void resize(std::size_t pageCount);
+            void rebuildPage(const WorldSnapshot &snapshot, std::size_t page, float tileSize);
+            void setLevels(const std::vector<std::uint8_t> &levels);
+            const std::vector<Matrix> &getTransforms(Lod lod, std::size_t team);
+            const std::vector<Vector3> &getRings();
+
+            [[nodiscard]] std::size_t getTeamCount() const { return _dirty.size(); }
+
+        private:
+            struct Batch {
+                std::vector<std::vector<Matrix>> teams;
+                std::vector<std::vector<std::uint32_t>> teamChunks;
+                std::vector<Vector3> rings;
+                std::vector<std::uint32_t> ringChunks;
+            };
+
+            [[nodiscard]] std::uint8_t levelOf(std::uint32_t chunk) const
+            {
+                return chunk < _levels.size() ? _levels[chunk] : static_cast<std::uint8_t>(LOD_NEAR);
+            }
+
+            void join(std::size_t team);
+
+            Matrix _base{};
+            std::vector<Batch> _pages;
+            std::array<std::vector<std::vector<Matrix>>, LOD_COUNT> _joined;
+            std::vector<std::uint8_t> _dirty;
+            std::vector<Vector3> _rings;
+            bool _ringsDirty = false;
+            std::vector<std::uint8_t> _levels;
+    };
+} // namespace GUI
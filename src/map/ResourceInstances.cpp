@@ -0,0 +1,208 @@
+/**
+ * @file ResourceInstances.cpp
+ * @brief Implementation of the ResourceInstances class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the ResourceInstances class.
+ * A chunk is rebuilt from its TileChunk, read directly (tiles outside the
+ * map hold no resource). Only the chunks rebuilt or moved to another level
+ * are taken out of the per-level arrays and placed again.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** ResourceInstances.cpp
+*/
+
+#include "ResourceInstances.hpp"
+#include <algorithm>
+#include <functional>
+#include <raymath.h>
+
+/**
+ * @brief Sets the model drawn for a resource
+ *
+ * Must be called before the chunks are built: the model transform is folded
+ * into the matrices.
+ *
+ * @param resource Resource index
+ * @param model Model of the resource, or nullptr to draw spheres
+ */
+void GUI::ResourceInstances::setModel(std::size_t resource, const Model *model)
+{
+    _bases[resource] = model != nullptr ? model->transform : MatrixIdentity();
+    _hasModel[resource] = model != nullptr;
+}
+
+/**
+ * @brief Drops every transform and sizes the chunk table
+ *
+ * Chunks start at the level the last setLevels() gave them.
+ *
+ * @param chunkCount Number of tile chunks of the snapshots
+ */
+void GUI::ResourceInstances::reset(std::size_t chunkCount)
+{
+    _chunks.assign(chunkCount, Chunk{});
+    for (std::size_t chunk = 0; chunk < chunkCount && chunk < _levels.size(); chunk++)
+        _chunks[chunk].level = _levels[chunk];
+    for (auto &resources : _joined) {
+        for (Joined &joined : resources) {
+            joined.transforms.clear();
+            joined.owners.clear();
+            joined.slots.clear();
+        }
+    }
+}
+
+/**
+ * @brief Recomputes the transforms of one chunk
+ *
+ * Copies of a resource are laid out on a 3 x 2 grid around the tile center,
+ * each resource shifted by its own offset so they do not overlap. Markers
+ * are laid out on a 3 x 3 grid, one cell per resource.
+ *
+ * @param snapshot Snapshot holding the chunk
+ * @param chunk Chunk index in the snapshot, row by row
+ * @param tileSize Size of a tile in world units
+ */
+void GUI::ResourceInstances::rebuildChunk(const WorldSnapshot &snapshot, std::size_t chunk, float tileSize)
+{
+    const TileChunk &tiles = *snapshot.getChunk(chunk);
+    const std::size_t chunksX = static_cast<std::size_t>(snapshot.getChunksX());
+    const int x0 = static_cast<int>(chunk % chunksX) * TileChunk::CHUNK_SIZE;
+    const int y0 = static_cast<int>(chunk / chunksX) * TileChunk::CHUNK_SIZE;
+    Chunk &batches = _chunks[chunk];
+
+    for (std::size_t resource = 0; resource < RESOURCE_COUNT; resource++) {
+        std::vector<Matrix> &copies = batches.copies[resource];
+        std::vector<Matrix> &markers = batches.markers[resource];
+        const auto &quantities = tiles.quantities[resource];
+
+        if (markers.empty() && std::all_of(quantities.begin(), quantities.end(), [](auto q) { return q == 0; }))
+            continue;
+        unplace(chunk, resource);
+        copies.clear();
+        markers.clear();
+
+        const float dx = static_cast<float>(resource % 2) * 0.1f;
+        const float dz = static_cast<float>(resource / 2) * 0.1f;
+        const float markerX = static_cast<float>(static_cast<int>(resource % 3) - 1) * 0.3f * tileSize;
+        const float markerZ = static_cast<float>(static_cast<int>(resource / 3) - 1) * 0.3f * tileSize;
+        for (std::size_t offset = 0; offset < TileChunk::CHUNK_TILES; offset++) {
+            const int quantity = static_cast<int>(quantities[offset]);
+            if (quantity <= 0)
+                continue;
+
+            const float x = static_cast<float>(x0 + static_cast<int>(offset % TileChunk::CHUNK_SIZE)) * tileSize;
+            const float z = static_cast<float>(y0 + static_cast<int>(offset / TileChunk::CHUNK_SIZE)) * tileSize;
+            const float scale = _hasModel[resource] ? MODEL_SCALE : std::min(0.2f, 0.05f + static_cast<float>(quantity) * 0.02f);
+            const Matrix scaling = MatrixScale(scale, scale, scale);
+
+            for (int count = 0; count < quantity && count < MAX_PER_TILE; count++) {
+                const Matrix translation = MatrixTranslate(
+                    x + static_cast<float>((count % 3) - 1) * 0.15f + dx,
+                    0.15f,
+                    z + static_cast<float>((count / 3) - 1) * 0.15f + dz);
+                copies.push_back(MatrixMultiply(scaling, translation));
+            }
+
+            const float marker = MARKER_SIZE * tileSize * static_cast<float>(std::min(quantity, MAX_PER_TILE)) / MAX_PER_TILE;
+            markers.push_back(MatrixMultiply(MatrixScale(marker, 1.0f, marker),
+                MatrixTranslate(x + markerX, MARKER_HEIGHT, z + markerZ)));
+        }
+        place(chunk, resource);
+    }
+}
+
+/**
+ * @brief Sets the detail level of each chunk
+ *
+ * Only the chunks whose level changed are moved between arrays.
+ *
+ * @param levels One Lod per chunk, LOD_CULLED if the chunk is not drawn;
+ *        chunks past its end are drawn at LOD_NEAR
+ */
+void GUI::ResourceInstances::setLevels(const std::vector<std::uint8_t> &levels)
+{
+    if (levels == _levels)
+        return;
+    _levels = levels;
+
+    for (std::size_t chunk = 0; chunk < _chunks.size(); chunk++) {
+        const std::uint8_t level = chunk < levels.size() ? levels[chunk] : static_cast<std::uint8_t>(LOD_NEAR);
+        if (level == _chunks[chunk].level)
+            continue;
+        for (std::size_t resource = 0; resource < RESOURCE_COUNT; resource++)
+            unplace(chunk, resource);
+        _chunks[chunk].level = level;
+        for (std::size_t resource = 0; resource < RESOURCE_COUNT; resource++)
+            place(chunk, resource);
+    }
+}
+
+/**
+ * @brief Appends the transforms of a chunk to the array of its level
+ *
+ * The model transform is folded into the near copies here, so that a
+ * chunk going back and forth between levels is not rebuilt.
+ *
+ * @param chunk Chunk index
+ * @param resource Resource index
+ */
+void GUI::ResourceInstances::place(std::size_t chunk, std::size_t resource)
+{
+    Chunk &batches = _chunks[chunk];
+    const std::uint8_t level = batches.level;
+    if (level == LOD_CULLED)
+        return;
+
+    Joined &joined = _joined[level][resource];
+    std::vector<std::uint32_t> &placed = batches.placed[resource];
+    const std::vector<Matrix> &source = level == LOD_FAR ? batches.markers[resource] : batches.copies[resource];
+
+    for (const Matrix &transform : source) {
+        placed.push_back(static_cast<std::uint32_t>(joined.transforms.size()));
+        joined.transforms.push_back(level == LOD_NEAR ? MatrixMultiply(_bases[resource], transform) : transform);
+        joined.owners.push_back(static_cast<std::uint32_t>(chunk));
+        joined.slots.push_back(static_cast<std::uint32_t>(placed.size() - 1));
+    }
+}
+
+/**
+ * @brief Takes the transforms of a chunk out of the array of its level
+ *
+ * Entries are removed from the highest index down, each hole filled with
+ * the last entry, whose owner chunk is told its new index. The last entry
+ * never belongs to the chunk being removed then, since its remaining
+ * entries are all lower than the hole.
+ *
+ * @param chunk Chunk index
+ * @param resource Resource index
+ */
+void GUI::ResourceInstances::unplace(std::size_t chunk, std::size_t resource)
+{
+    Chunk &batches = _chunks[chunk];
+    std::vector<std::uint32_t> &placed = batches.placed[resource];
+    if (placed.empty())
+        return;
+
+    Joined &joined = _joined[batches.level][resource];
+    std::sort(placed.begin(), placed.end(), std::greater<std::uint32_t>());
+    for (std::uint32_t hole : placed) {
+        const std::size_t last = joined.transforms.size() - 1;
+        if (hole != last) {
+            joined.transforms[hole] = joined.transforms[last];
+            joined.owners[hole] = joined.owners[last];
+            joined.slots[hole] = joined.slots[last];
+            _chunks[joined.owners[hole]].placed[resource][joined.slots[hole]] = hole;
+        }
+        joined.transforms.pop_back();
+        joined.owners.pop_back();
+        joined.slots.pop_back();
+    }
+    placed.clear();
+}
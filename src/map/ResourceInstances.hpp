@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** ResourceInstances.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "LodSelector.hpp"
+#include "../world/WorldSnapshot.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Transforms of the resource copies drawn on the map, by type
+     *
+     * Each tile shows up to MAX_PER_TILE copies of each resource it holds.
+     * Their transforms are kept per tile chunk of the snapshots and per
+     * resource, so a chunk that changed is rebuilt alone, and placed in one
+     * array per detail level and resource, which InstancingShader draws in
+     * one call per mesh. A chunk is placed in the array of the level given
+     * by the last setLevels(); culled chunks are left out.
+     *
+     * The arrays are in no particular order. Each entry records the chunk
+     * it belongs to and each chunk where its entries are, so a chunk is
+     * taken out by moving the last entries into its holes: rebuilding a
+     * chunk or changing its level costs its own instances, never a pass
+     * over the whole array.
+     *
+     * Near and middle levels draw every copy, with the resource model or a
+     * low-poly stand-in; the far level draws one flat marker per tile and
+     * resource, sized by the quantity. Near matrices hold the model
+     * transform, scaled by MODEL_SCALE. Without a model, the matrix scale
+     * is the radius of the sphere drawn instead, which grows with the
+     * quantity.
+     */
+    class ResourceInstances {
+        public:
+            static constexpr std::size_t RESOURCE_COUNT = TileStore::RESOURCE_COUNT;
+            static constexpr int MAX_PER_TILE = 5;
+            static constexpr float MODEL_SCALE = 0.1f;
+            static constexpr float MARKER_SIZE = 0.25f;      // in tiles, for 5 or more units
+            static constexpr float MARKER_HEIGHT = 0.06f;
+
+            void setModel(std::size_t resource, const Model *model);
+            void reset(std::size_t chunkCount);
+            void rebuildChunk(const WorldSnapshot &snapshot, std::size_t chunk, float tileSize);
+            void setLevels(const std::vector<std::uint8_t> &levels);
+            [[nodiscard]] const std::vector<Matrix> &getTransforms(Lod lod, std::size_t resource) const
+            {
+                return _joined[lod][resource].transforms;
+            }
+
+        private:
+            using Batches = std::array<std::vector<Matrix>, RESOURCE_COUNT>;
+
+            struct Chunk {
+                Batches copies;     // without the model transform
+                Batches markers;
+                std::array<std::vector<std::uint32_t>, RESOURCE_COUNT> placed;    // entries in _joined
+                std::uint8_t level = LOD_NEAR;                                     // level placed at
+            };
+
+            struct Joined {
+                std::vector<Matrix> transforms;
+                std::vector<std::uint32_t> owners;    // chunk of each entry
+                std::vector<std::uint32_t> slots;     // index of each entry in its chunk's placed list
+            };
+
+            void place(std::size_t chunk, std::size_t resource);
+            void unplace(std::size_t chunk, std::size_t resource);
+
+            std::array<Matrix, RESOURCE_COUNT> _bases{};
+            std::array<bool, RESOURCE_COUNT> _hasModel{};
+            std::vector<Chunk> _chunks;
+            std::array<std::array<Joined, RESOURCE_COUNT>, LOD_COUNT> _joined;
+            std::vector<std::uint8_t> _levels;
+    };
+} // namespace GUI
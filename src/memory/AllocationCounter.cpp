@@ -0,0 +1,100 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief Counting replacement of the global operator new for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file replaces the global allocation functions with versions that
+ * count, per thread, how many allocations were made and how many bytes
+ * were requested, before forwarding to malloc(). The counters are plain
+ * thread-local integers: counting costs an increment, no atomic and no
+ * lock. The array and nothrow forms of operator new call the replaced
+ * scalar forms, so they are counted too.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** AllocationCounter.cpp
+*/
+
+#include "AllocationCounter.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    thread_local std::uint64_t allocations = 0;
+    thread_local std::uint64_t allocatedBytes = 0;
+
+    void *counted_alloc(std::size_t size, std::size_t alignment)
+    {
+        allocations++;
+        allocatedBytes += size;
+
+        if (size == 0)
+            size = 1;
+        void *pointer = nullptr;
+        if (alignment <= alignof(std::max_align_t))
+            pointer = std::malloc(size);
+        else if (posix_memalign(&pointer, alignment, size) != 0)
+            pointer = nullptr;
+        return pointer;
+    }
+
+    void *counted_new(std::size_t size, std::size_t alignment)
+    {
+        for (;;) {
+            void *pointer = counted_alloc(size, alignment);
+            if (pointer != nullptr)
+                return pointer;
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+} // namespace
+
+std::uint64_t GUI::AllocationCounter::count()
+{
+    return allocations;
+}
+
+std::uint64_t GUI::AllocationCounter::bytes()
+{
+    return allocatedBytes;
+}
+
+void *operator new(std::size_t size)
+{
+    return counted_new(size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return counted_new(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
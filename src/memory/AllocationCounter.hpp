@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** AllocationCounter.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace GUI::AllocationCounter {
+
+    /**
+     * @brief Heap allocations made by the calling thread so far
+     *
+     * Every allocation through operator new (containers, strings,
+     * make_shared, ...) is counted for the thread that made it. malloc()
+     * calls made directly, e.g. by raylib, are not counted.
+     *
+     * Meant to be sampled around a frame or an ingest step: the difference
+     * is the number of allocations that step made.
+     */
+    std::uint64_t count();
+
+    /**
+     * @brief Bytes requested by those allocations
+     */
+    std::uint64_t bytes();
+
+} // namespace GUI::AllocationCounter
@@ -6,19 +6,34 @@
 */
 
 #include "NetworkManager.hpp"
+#include "../log/Logger.hpp"
 #include <arpa/inet.h>
-#include <iostream>
+#include <cerrno>
+#include <fcntl.h>
 #include <netinet/in.h>
 #include <poll.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
+#ifdef MSG_NOSIGNAL
+    #define ZAPPY_SEND_FLAGS MSG_NOSIGNAL
+#else
+    #define ZAPPY_SEND_FLAGS 0
+#endif
+
 /**
  * @brief Default constructor for NetworkManager
  *
- * Initializes the socket file descriptor to -1 (invalid state)
+ * Initializes the socket file descriptor to -1 (invalid state) and the
+ * outbound queue to empty
  */
-GUI::NetworkManager::NetworkManager() : _socket_fd(-1)
+GUI::NetworkManager::NetworkManager()
+    : _socket_fd(-1), _output_begin(0), _output_end(0), _output_offset(0),
+      _output_bytes(0), _output_peak(0), _send_calls(0)
 {
 }
 
@@ -49,7 +64,7 @@ bool GUI::NetworkManager::create_and_connect(const std::string& hostname, int po
 {
     _socket_fd = socket(AF_INET, SOCK_STREAM, 0);
     if (_socket_fd == -1) {
-        std::cerr << "Error creating socket" << std::endl;
+        ZLOG_ERROR(Network, "Error creating socket");
         return false;
     }
 
@@ -58,18 +73,18 @@ bool GUI::NetworkManager::create_and_connect(const std::string& hostname, int po
     server_addr.sin_port = htons(port);
 
     if (inet_pton(AF_INET, hostname.c_str(), &server_addr.sin_addr) <= 0) {
-        std::cerr << "Invalid address: " << hostname << std::endl;
+        ZLOG_ERROR(Network, "Invalid address: %s", hostname.c_str());
         close_connection();
         return false;
     }
 
     if (connect(_socket_fd, (struct sockaddr*)&server_addr, sizeof(server_addr)) < 0) {
-        std::cerr << "Connection failed to " << hostname << ":" << port << std::endl;
+        ZLOG_ERROR(Network, "Connection failed to %s:%d", hostname.c_str(), port);
         close_connection();
         return false;
     }
 
-    std::cout << "Successfully connected to " << hostname << ":" << port << std::endl;
+    ZLOG_INFO(Network, "Successfully connected to %s:%d", hostname.c_str(), port);
     return true;
 }
 
@@ -89,79 +104,212 @@ bool GUI::NetworkManager::create_and_connect(const std::string& hostname, int po
 bool GUI::NetworkManager::authenticate()
 {
     if (_socket_fd == -1) {
-        std::cerr << "Cannot authenticate: not connected" << std::endl;
+        ZLOG_ERROR(Network, "Cannot authenticate: not connected");
         return false;
     }
 
     char buffer[1024];
     ssize_t bytes_read = recv(_socket_fd, buffer, sizeof(buffer) - 1, 0);
     if (bytes_read <= 0) {
-        std::cerr << "Failed to receive WELCOME message" << std::endl;
+        ZLOG_ERROR(Network, "Failed to receive WELCOME message");
         return false;
     }
 
     buffer[bytes_read] = '\0';
-    std::cout << "Received: " << buffer;
+    ZLOG_DEBUG(Network, "Received: %.*s", (int)std::strcspn(buffer, "\n"), buffer);
 
     if (std::string(buffer) != "WELCOME\n") {
-        std::cerr << "Expected WELCOME, got: " << buffer << std::endl;
+        ZLOG_ERROR(Network, "Expected WELCOME, got: %s", buffer);
         return false;
     }
 
     const char* graphic_cmd = "GRAPHIC\n";
     if (send(_socket_fd, graphic_cmd, 8, 0) != 8) {
-        std::cerr << "Failed to send GRAPHIC command" << std::endl;
+        ZLOG_ERROR(Network, "Failed to send GRAPHIC command");
         return false;
     }
 
-    std::cout << "Successfully authenticated as GUI client" << std::endl;
+    ZLOG_INFO(Network, "Successfully authenticated as GUI client");
     return true;
 }
 
 /**
  * @brief Sends a command to the connected server
  *
- * Appends a newline character to the command and sends it through the socket.
- * The method ensures the entire command is sent by checking the return value.
+ * Queues the command with queue_command() and immediately tries to flush
+ * the outbound queue.
  *
  * @param command The command string to send (without trailing newline)
- * @return true if the command was successfully sent, false otherwise
+ * @return true if the command was queued and no write error occurred,
+ *         false otherwise
  *
  * @note Requires an active connection (socket must be valid)
- * @note A newline character is automatically appended to the command
- * @note The method verifies that all bytes were sent successfully
+ * @note On a non-blocking socket the command may still be partially pending
+ *       when this returns; it is completed by later calls to flush()
  */
 bool GUI::NetworkManager::send_command(const std::string& command)
 {
-    if (_socket_fd == -1) {
-        std::cerr << "Cannot send command: not connected" << std::endl;
+    if (!queue_command(command)) {
+        ZLOG_ERROR(Network, "Failed to send command: %s", command.c_str());
         return false;
     }
+    return flush();
+}
 
-    std::string cmd = command + "\n";
-    ssize_t sent = send(_socket_fd, cmd.c_str(), cmd.length(), 0);
-    if (sent != static_cast<ssize_t>(cmd.length())) {
-        std::cerr << "Failed to send command: " << command << std::endl;
+/**
+ * @brief Appends a command to the outbound queue without writing it
+ *
+ * The command and its trailing newline are copied into a reused entry of the
+ * outbound queue; entries keep their capacity, so queueing does not allocate
+ * once the queue has warmed up. Everything queued is written by the next
+ * flush() with as few system calls as possible.
+ *
+ * @param command The command to queue (without trailing newline)
+ * @return true if the command was queued, false if not connected or if the
+ *         queue already holds OUTPUT_HARD_LIMIT bytes
+ */
+bool GUI::NetworkManager::queue_command(std::string_view command)
+{
+    if (_socket_fd == -1 || _output_bytes >= OUTPUT_HARD_LIMIT)
         return false;
+
+    if (_output_end == _output.size()) {
+        if (_output_begin > 0) {
+            std::rotate(_output.begin(), _output.begin() + static_cast<std::ptrdiff_t>(_output_begin), _output.end());
+            _output_end -= _output_begin;
+            _output_begin = 0;
+        } else {
+            _output.emplace_back();
+        }
     }
 
+    std::string &entry = _output[_output_end++];
+    entry.assign(command.data(), command.size());
+    entry.push_back('\n');
+    _output_bytes += entry.size();
+    _output_peak = std::max(_output_peak, _output_bytes);
     return true;
 }
 
+/**
+ * @brief Writes as much of the outbound queue as the socket accepts
+ *
+ * Gathers the pending entries into an iovec array and writes them with a
+ * single sendmsg() call (more only when the queue exceeds IOV_MAX entries).
+ * A partial write keeps the unwritten tail queued; on a non-blocking socket
+ * a full kernel buffer is not an error and the remaining bytes are written
+ * by a later call.
+ *
+ * @return true if no write error occurred, false on error or if not connected
+ */
+bool GUI::NetworkManager::flush()
+{
+    if (_socket_fd == -1)
+        return false;
+
+    while (_output_begin < _output_end) {
+        const std::size_t count = std::min<std::size_t>(_output_end - _output_begin, IOV_MAX);
+        _iov.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::string &entry = _output[_output_begin + i];
+            const std::size_t skip = i == 0 ? _output_offset : 0;
+            _iov[i].iov_base = const_cast<char *>(entry.data() + skip);
+            _iov[i].iov_len = entry.size() - skip;
+        }
+
+        struct msghdr message = {};
+        message.msg_iov = _iov.data();
+        message.msg_iovlen = count;
+        ssize_t sent = sendmsg(_socket_fd, &message, ZAPPY_SEND_FLAGS);
+        if (sent < 0) {
+            if (would_block())
+                return true;
+            ZLOG_ERROR(Network, "Failed to send queued commands");
+            return false;
+        }
+        _send_calls++;
+        if (sent == 0)
+            return true;
+
+        auto remaining = static_cast<std::size_t>(sent);
+        _output_bytes -= remaining;
+        while (remaining > 0) {
+            const std::size_t left = _output[_output_begin].size() - _output_offset;
+            if (remaining < left) {
+                _output_offset += remaining;
+                break;
+            }
+            remaining -= left;
+            _output_offset = 0;
+            _output_begin++;
+        }
+        if (_output_begin < _output_end && _output_offset > 0)
+            return true;
+    }
+
+    _output_begin = 0;
+    _output_end = 0;
+    _output_offset = 0;
+    return true;
+}
+
+/**
+ * @brief Returns the number of queued bytes not yet written to the socket
+ *
+ * @return size_t Pending outbound bytes
+ */
+std::size_t GUI::NetworkManager::pending_output() const
+{
+    return _output_bytes;
+}
+
+/**
+ * @brief Returns the largest number of pending outbound bytes observed
+ *
+ * @return size_t Peak of pending_output() since the manager was created
+ */
+std::size_t GUI::NetworkManager::peak_pending_output() const
+{
+    return _output_peak;
+}
+
+/**
+ * @brief Returns the number of write system calls made by flush()
+ *
+ * @return uint64_t Successful sendmsg() calls since the manager was created
+ */
+std::uint64_t GUI::NetworkManager::send_calls() const
+{
+    return _send_calls;
+}
+
+/**
+ * @brief Tells whether the outbound queue is above its high-water mark
+ *
+ * Producers of optional traffic (periodic queries) should hold off while
+ * this returns true, as the server is not reading fast enough.
+ *
+ * @return true if at least OUTPUT_HIGH_WATER_MARK bytes are pending
+ */
+bool GUI::NetworkManager::is_congested() const
+{
+    return _output_bytes >= OUTPUT_HIGH_WATER_MARK;
+}
+
 /**
  * @brief Receives data from the connected server
  *
- * Attempts to read data from the socket into the provided buffer.
- * The method reserves one byte for null termination.
+ * Attempts to read data from the socket into the provided buffer, typically
+ * the free space returned by CommunicationBuffer::prepare().
  *
  * @param buffer Pointer to the buffer where received data will be stored
  * @param buffer_size Size of the buffer in bytes
  * @return Number of bytes received, or -1 if not connected or on error
  *
  * @note Requires an active connection (socket must be valid)
- * @note The method reserves one byte in the buffer for null termination
+ * @note The whole buffer may be filled; the data is not null-terminated
  * @note Returns -1 if no connection is established
- * @note The caller is responsible for null-terminating the received data if needed
+ * @note On a non-blocking socket, -1 with would_block() true means no data yet
  */
 ssize_t GUI::NetworkManager::receive_data(char* buffer, size_t buffer_size)
 {
@@ -169,16 +317,33 @@ ssize_t GUI::NetworkManager::receive_data(char* buffer, size_t buffer_size)
         return -1;
     }
 
-    return recv(_socket_fd, buffer, buffer_size - 1, 0);
+    return recv(_socket_fd, buffer, buffer_size, 0);
+}
+
+/**
+ * @brief Tells whether the last failed receive_data() only lacked data
+ *
+ * @return true if errno reports a non-blocking read with nothing to read
+ *         or an interrupted call, both of which are not connection errors
+ *
+ * @note Must be checked right after receive_data() returned -1
+ */
+bool GUI::NetworkManager::would_block()
+{
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
 }
 
 /**
  * @brief Polls the socket for incoming data with a timeout
  *
  * Uses the poll() system call to check if data is available for reading
- * on the socket without blocking indefinitely.
+ * on the socket without blocking indefinitely. While outbound data is
+ * pending, the call also returns as soon as the socket becomes writable, so
+ * the caller can flush(). An optional wake descriptor (the read end of a
+ * pipe) lets another thread interrupt the wait; its content is consumed.
  *
  * @param timeout_ms Timeout in milliseconds (0 for immediate return, -1 for infinite wait)
+ * @param wake_fd Descriptor that interrupts the wait when readable, or -1
  * @return true if data is available for reading, false if timeout occurred, no data available, or error
  *
  * @note Requires an active connection (socket must be valid)
@@ -186,23 +351,76 @@ ssize_t GUI::NetworkManager::receive_data(char* buffer, size_t buffer_size)
  * @note A timeout of 0 makes the call non-blocking
  * @note A timeout of -1 makes the call block indefinitely until data arrives
  */
-bool GUI::NetworkManager::poll_for_data(int timeout_ms)
+bool GUI::NetworkManager::poll_for_data(int timeout_ms, int wake_fd)
 {
     if (_socket_fd == -1) {
         return false;
     }
 
-    struct pollfd pfd;
-    pfd.fd = _socket_fd;
-    pfd.events = POLLIN;
+    struct pollfd pfd[2] = {};
+    pfd[0].fd = _socket_fd;
+    pfd[0].events = POLLIN;
+    if (_output_bytes > 0)
+        pfd[0].events |= POLLOUT;
+    pfd[1].fd = wake_fd;
+    pfd[1].events = POLLIN;
 
-    int ret = poll(&pfd, 1, timeout_ms);
+    int ret = poll(pfd, wake_fd == -1 ? 1 : 2, timeout_ms);
     if (ret < 0) {
-        std::cerr << "Poll error on socket" << std::endl;
+        if (errno == EINTR)
+            return false;
+        ZLOG_ERROR(Network, "Poll error on socket");
         return false;
     }
 
-    return ret > 0 && ((pfd.revents & POLLIN) != 0);
+    if (wake_fd != -1 && (pfd[1].revents & POLLIN) != 0) {
+        char drain[64];
+        while (read(wake_fd, drain, sizeof(drain)) > 0) {
+        }
+    }
+
+    return ret > 0 && ((pfd[0].revents & POLLIN) != 0);
+}
+
+/**
+ * @brief Switches the socket between blocking and non-blocking mode
+ *
+ * The authentication handshake is done in blocking mode; the socket is then
+ * switched to non-blocking so it can be drained until EAGAIN.
+ *
+ * @param enabled true for non-blocking mode, false for blocking mode
+ * @return true if the mode was applied, false if not connected or on error
+ */
+bool GUI::NetworkManager::set_non_blocking(bool enabled)
+{
+    if (_socket_fd == -1)
+        return false;
+
+    int flags = fcntl(_socket_fd, F_GETFL, 0);
+    if (flags == -1)
+        return false;
+
+    flags = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    if (fcntl(_socket_fd, F_SETFL, flags) == -1) {
+        ZLOG_ERROR(Network, "Failed to change socket blocking mode");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the number of bytes waiting in the kernel receive buffer
+ *
+ * @return Number of bytes that a receive_data() call could read right away,
+ *         or 0 if not connected or on error
+ */
+std::size_t GUI::NetworkManager::pending_bytes() const
+{
+    int pending = 0;
+
+    if (_socket_fd == -1 || ioctl(_socket_fd, FIONREAD, &pending) == -1)
+        return 0;
+    return static_cast<std::size_t>(pending);
 }
 
 /**
@@ -220,7 +438,11 @@ void GUI::NetworkManager::close_connection()
     if (_socket_fd != -1) {
         close(_socket_fd);
         _socket_fd = -1;
-        std::cout << "Connection closed" << std::endl;
+        _output_begin = 0;
+        _output_end = 0;
+        _output_offset = 0;
+        _output_bytes = 0;
+        ZLOG_INFO(Network, "Connection closed");
     }
 }
 
@@ -5,12 +5,22 @@
 ** NetworkManager.hpp
 */
 
+#pragma once
+
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <vector>
 
 namespace GUI {
 
     class NetworkManager {
         public:
+            static constexpr std::size_t OUTPUT_HIGH_WATER_MARK = 64 * 1024;
+            static constexpr std::size_t OUTPUT_HARD_LIMIT = 1024 * 1024;
+
             NetworkManager();
             ~NetworkManager();
             
@@ -20,10 +30,20 @@ namespace GUI {
             bool create_and_connect(const std::string& hostname, int port);
             bool authenticate();
             bool send_command(const std::string& command);
+
+            bool queue_command(std::string_view command);
+            bool flush();
+            [[nodiscard]] std::size_t pending_output() const;
+            [[nodiscard]] std::size_t peak_pending_output() const;
+            [[nodiscard]] std::uint64_t send_calls() const;
+            [[nodiscard]] bool is_congested() const;
             
             ssize_t receive_data(char* buffer, size_t buffer_size);
+            [[nodiscard]] static bool would_block();
             
-            bool poll_for_data(int timeout_ms = 100);
+            bool poll_for_data(int timeout_ms = 100, int wake_fd = -1);
+            bool set_non_blocking(bool enabled);
+            [[nodiscard]] std::size_t pending_bytes() const;
             
             void close_connection();
             
@@ -31,5 +51,14 @@ namespace GUI {
             
         private:
             int _socket_fd;
+
+            std::vector<std::string> _output;
+            std::vector<struct iovec> _iov;
+            std::size_t _output_begin;
+            std::size_t _output_end;
+            std::size_t _output_offset;
+            std::size_t _output_bytes;
+            std::size_t _output_peak;
+            std::uint64_t _send_calls;
     };
 } // namespace GUI
@@ -0,0 +1,511 @@
+/**
+ * @file NetworkThread.cpp
+ * @brief Implementation of the NetworkThread class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the NetworkThread class which owns
+ * the NetworkManager on a dedicated thread. The thread performs every socket
+ * operation, splits the stream into complete messages and hands them to the
+ * ingest thread through a lock-free single-producer/single-consumer queue, so
+ * the render loop never waits on the network.
+ *
+ * The socket is non-blocking and drained until EAGAIN on every wake-up, within
+ * an IngestBudget, so the client keeps up with the server instead of reading a
+ * fixed amount per iteration.
+ *
+ * Commands issued by the ingest thread during an ingest step are held in the outbound
+ * queue until the step ends, then handed to the NetworkManager and written
+ * together with a single gathered write.
+ *
+ * The thread can also record every chunk it receives to a capture file, or
+ * replace the socket altogether by replaying such a file, so that the rest of
+ * the pipeline runs unchanged without a server.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** NetworkThread.cpp
+*/
+
+#include "NetworkThread.hpp"
+#include "../log/Logger.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructs a NetworkThread around an already connected manager
+ *
+ * The manager must have completed create_and_connect() and authenticate().
+ * From start() on, it is only ever touched by the network thread.
+ *
+ * A non-blocking pipe is created so the ingest thread can wake the network
+ * thread out of poll() when a step's commands are ready to be flushed.
+ *
+ * @param manager Connected and authenticated network manager
+ * @param budget Limits applied to each socket drain
+ */
+GUI::NetworkThread::NetworkThread(std::unique_ptr<NetworkManager> manager, IngestBudget budget)
+    : _manager(std::move(manager)), _replay_speed(0.0), _budget(budget), _inbound(INBOUND_CAPACITY),
+      _outbound(OUTBOUND_CAPACITY), _running(false), _connected(false),
+      _flush_requested(false), _congested(false), _wake_pipe{-1, -1},
+      _messages_received(0), _inbound_stalls(0), _dropped_commands(0),
+      _kernel_pending_bytes(0), _buffered_bytes(0), _queued_bytes(0),
+      _outbound_pending_bytes(0), _outbound_peak_bytes(0), _send_calls(0)
+{
+    if (pipe(_wake_pipe) == 0) {
+        fcntl(_wake_pipe[0], F_SETFL, fcntl(_wake_pipe[0], F_GETFL, 0) | O_NONBLOCK);
+        fcntl(_wake_pipe[1], F_SETFL, fcntl(_wake_pipe[1], F_GETFL, 0) | O_NONBLOCK);
+    } else {
+        ZLOG_ERROR(Network, "Failed to create network wake pipe");
+        _wake_pipe[0] = -1;
+        _wake_pipe[1] = -1;
+    }
+}
+
+/**
+ * @brief Constructs a NetworkThread that replays a capture instead of a socket
+ *
+ * The chunks of the capture go through the same communication buffer and
+ * inbound queue as socket data. Commands queued with send_command() are
+ * accepted and discarded.
+ *
+ * @param replay Opened capture file
+ * @param speed Playback speed relative to the recording (2.0 plays twice as
+ *              fast); 0 feeds the chunks as fast as they are consumed
+ * @param budget Limits applied to each ingest step
+ */
+GUI::NetworkThread::NetworkThread(std::unique_ptr<CaptureReader> replay, double speed, IngestBudget budget)
+    : NetworkThread(std::unique_ptr<NetworkManager>(), budget)
+{
+    _replay = std::move(replay);
+    _replay_speed = speed;
+}
+
+/**
+ * @brief Destructor of the NetworkThread class
+ *
+ * Stops and joins the network thread before the manager is destroyed.
+ */
+GUI::NetworkThread::~NetworkThread()
+{
+    stop();
+    if (_wake_pipe[0] != -1)
+        close(_wake_pipe[0]);
+    if (_wake_pipe[1] != -1)
+        close(_wake_pipe[1]);
+}
+
+/**
+ * @brief Starts the network thread
+ *
+ * Switches the socket to non-blocking mode before the thread starts reading.
+ * In replay mode, the thread reads the capture file instead.
+ *
+ * @note Calling start() on an already running thread has no effect
+ */
+void GUI::NetworkThread::start()
+{
+    if (_running.exchange(true))
+        return;
+    if (_replay) {
+        _connected = true;
+        _thread = std::thread(&NetworkThread::replay_loop, this);
+        return;
+    }
+    _manager->set_non_blocking(true);
+    _connected = _manager->is_connected();
+    _record_start = std::chrono::steady_clock::now();
+    _thread = std::thread(&NetworkThread::loop, this);
+}
+
+/**
+ * @brief Requests the network thread to stop and waits for it
+ *
+ * The thread is woken up through the wake pipe, so it notices the request
+ * right away.
+ */
+void GUI::NetworkThread::stop()
+{
+    _running = false;
+    wake();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+/**
+ * @brief Records every chunk received from now on to a capture file
+ *
+ * @param path Path of the capture file to create
+ * @return true if the file was created
+ *
+ * @note Must be called before start(); has no effect in replay mode
+ */
+bool GUI::NetworkThread::record_to(const std::string &path)
+{
+    if (_replay || _running)
+        return false;
+
+    auto recorder = std::make_unique<CaptureWriter>();
+    if (!recorder->open(path))
+        return false;
+    _recorder = std::move(recorder);
+    ZLOG_INFO(Network, "Recording server data to %s", path.c_str());
+    return true;
+}
+
+/**
+ * @brief Queues a command to be sent by the network thread
+ *
+ * The command is copied into a preallocated outbound slot, whose string
+ * keeps its capacity from one use to the next. It is written to
+ * the socket with the rest of the step's commands after flush_commands(),
+ * or earlier if the outbound queue is half full.
+ *
+ * @param command The command string to send (without trailing newline)
+ * @return true if the command was queued, false if the connection is gone
+ *         or the outbound queue is full (the command is then dropped)
+ *
+ * @note Must only be called from a single thread at a time (the ingest
+ *       thread once it is started)
+ */
+bool GUI::NetworkThread::send_command(std::string_view command)
+{
+    if (!_connected)
+        return false;
+
+    std::string *slot = _outbound.acquire();
+    if (slot == nullptr) {
+        _dropped_commands.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    slot->assign(command);
+    _outbound.publish();
+    return true;
+}
+
+/**
+ * @brief Marks the end of an ingest step's commands
+ *
+ * Wakes the network thread so that every command queued since the previous
+ * call is written with a single gathered write.
+ *
+ * @note Must be called from the thread that calls send_command()
+ */
+void GUI::NetworkThread::flush_commands()
+{
+    if (_outbound.empty())
+        return;
+    _flush_requested.store(true, std::memory_order_release);
+    wake();
+}
+
+/**
+ * @brief Tells whether outbound data is piling up above the high-water mark
+ *
+ * @return true while the server reads slower than commands are produced;
+ *         optional commands should then be held back
+ */
+bool GUI::NetworkThread::is_congested() const
+{
+    return _congested.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Interrupts the network thread's poll()
+ */
+void GUI::NetworkThread::wake()
+{
+    if (_wake_pipe[1] == -1)
+        return;
+
+    const char byte = 1;
+    if (write(_wake_pipe[1], &byte, 1) < 0) {
+        /* pipe already full: the thread is about to wake up anyway */
+    }
+}
+
+/**
+ * @brief Checks whether the server connection is still alive
+ *
+ * @return false once the network thread has observed a disconnection
+ */
+bool GUI::NetworkThread::is_connected() const
+{
+    return _connected;
+}
+
+/**
+ * @brief Checks whether messages are waiting to be drained
+ *
+ * @return true if the inbound queue is not empty
+ */
+bool GUI::NetworkThread::has_pending_messages() const
+{
+    return !_inbound.empty();
+}
+
+/**
+ * @brief Returns a snapshot of the network counters
+ *
+ * Besides queue depths and cumulative counters, reports how far behind the
+ * client is: bytes still in the kernel socket buffer, bytes received but not
+ * yet split, bytes queued for the ingest thread, and the age of the oldest
+ * message the ingest thread has not processed yet.
+ *
+ * @return NetworkStats Queue depths, counters and lag indicators
+ *
+ * @note Must be called from the thread that drains messages
+ * @note Values are read without synchronisation between each other
+ */
+GUI::NetworkStats GUI::NetworkThread::get_stats()
+{
+    NetworkStats stats;
+
+    stats.inbound_depth = _inbound.size();
+    stats.outbound_depth = _outbound.size();
+    stats.messages_received = _messages_received.load(std::memory_order_relaxed);
+    stats.inbound_stalls = _inbound_stalls.load(std::memory_order_relaxed);
+    stats.dropped_commands = _dropped_commands.load(std::memory_order_relaxed);
+    stats.kernel_pending_bytes = _kernel_pending_bytes.load(std::memory_order_relaxed);
+    stats.buffered_bytes = _buffered_bytes.load(std::memory_order_relaxed);
+    stats.queued_bytes = _queued_bytes.load(std::memory_order_relaxed);
+    stats.outbound_pending_bytes = _outbound_pending_bytes.load(std::memory_order_relaxed);
+    stats.outbound_peak_bytes = _outbound_peak_bytes.load(std::memory_order_relaxed);
+    stats.send_calls = _send_calls.load(std::memory_order_relaxed);
+    stats.congested = _congested.load(std::memory_order_relaxed);
+
+    const InboundMessage *oldest = _inbound.front();
+    if (oldest != nullptr) {
+        std::chrono::duration<double> age = std::chrono::steady_clock::now() - oldest->received;
+        stats.oldest_message_age = age.count();
+    }
+    return stats;
+}
+
+/**
+ * @brief Writes the commands queued by the ingest thread
+ *
+ * Once a flush was requested (or the outbound queue is half full), every
+ * queued command is moved to the NetworkManager's outbound queue. The
+ * manager then writes everything pending with one gathered write; a partial
+ * write is resumed on a later iteration, when poll() reports the socket
+ * writable again.
+ */
+void GUI::NetworkThread::flush_outbound()
+{
+    const bool requested = _flush_requested.exchange(false, std::memory_order_acquire);
+
+    if (requested || _outbound.size() >= OUTBOUND_CAPACITY / 2) {
+        for (std::string *command = _outbound.front(); command != nullptr; command = _outbound.front()) {
+            if (!_manager->queue_command(*command))
+                _dropped_commands.fetch_add(1, std::memory_order_relaxed);
+            _outbound.pop();
+        }
+    }
+
+    if (_manager->pending_output() > 0)
+        _manager->flush();
+
+    _outbound_pending_bytes.store(_manager->pending_output(), std::memory_order_relaxed);
+    _outbound_peak_bytes.store(_manager->peak_pending_output(), std::memory_order_relaxed);
+    _send_calls.store(_manager->send_calls(), std::memory_order_relaxed);
+    _congested.store(_manager->is_congested(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Drops the commands queued by the ingest thread
+ *
+ * Used in replay mode, where there is no server to send them to.
+ */
+void GUI::NetworkThread::discard_outbound()
+{
+    while (_outbound.front() != nullptr)
+        _outbound.pop();
+}
+
+/**
+ * @brief Moves complete messages from the buffer to the inbound queue
+ *
+ * Each message is stamped with the time of the read that completed it.
+ * Stops early when the inbound queue is full; the remaining messages stay
+ * in the communication buffer until the ingest thread catches up.
+ *
+ * @return true if every complete message was queued, false if the queue
+ *         filled up first
+ */
+bool GUI::NetworkThread::split_messages()
+{
+    bool drained = true;
+
+    while (_buffer.has_complete_message()) {
+        InboundMessage *slot = _inbound.acquire();
+        if (slot == nullptr) {
+            drained = false;
+            break;
+        }
+
+        std::string_view message = _buffer.extract_next_message();
+        if (message.empty())
+            continue;
+
+        slot->line.assign(message.data(), message.size());
+        slot->received = _last_receive;
+        // counted before it is visible, so the consumer's fetch_sub never
+        // runs first and wraps the counter around
+        _queued_bytes.fetch_add(message.size(), std::memory_order_relaxed);
+        _inbound.publish();
+        _messages_received.fetch_add(1, std::memory_order_relaxed);
+    }
+    _buffered_bytes.store(_buffer.size(), std::memory_order_relaxed);
+    return drained;
+}
+
+/**
+ * @brief Reads the socket until EAGAIN or until the budget is spent
+ *
+ * Data is split into messages after every read, so the buffer does not grow
+ * with the size of the burst.
+ *
+ * @return false if the server closed the connection or a read failed
+ */
+bool GUI::NetworkThread::receive_available()
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t total = 0;
+
+    while (total < _budget.max_bytes) {
+        char *free_space = _buffer.prepare(READ_CHUNK_SIZE);
+        ssize_t bytes_read = _manager->receive_data(free_space, _buffer.writable());
+        if (bytes_read == 0)
+            return false;
+        if (bytes_read < 0) {
+            if (NetworkManager::would_block())
+                break;
+            return false;
+        }
+
+        _buffer.commit(static_cast<std::size_t>(bytes_read));
+        total += static_cast<std::size_t>(bytes_read);
+        _last_receive = std::chrono::steady_clock::now();
+        if (_recorder) {
+            const std::chrono::nanoseconds timestamp = _last_receive - _record_start;
+            if (!_recorder->write_chunk(static_cast<std::uint64_t>(timestamp.count()),
+                    free_space, static_cast<std::size_t>(bytes_read)))
+                _recorder.reset();
+        }
+
+        if (!split_messages() || _last_receive - start >= _budget.max_time)
+            break;
+    }
+    _kernel_pending_bytes.store(_manager->pending_bytes(), std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Body of the network thread
+ *
+ * Each iteration sends pending commands, waits up to POLL_TIMEOUT_MS for
+ * data (or for a wake-up from the ingest thread), then drains the socket with receive_available(). Data is received
+ * directly into the free space of the communication buffer and each message
+ * is copied once, into a reused queue slot. When the inbound queue is full,
+ * the socket is left unread so the server is slowed down by TCP flow control
+ * instead of messages being dropped.
+ */
+void GUI::NetworkThread::loop()
+{
+    while (_running) {
+        flush_outbound();
+
+        if (!split_messages()) {
+            _inbound_stalls.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        if (!_manager->poll_for_data(POLL_TIMEOUT_MS, _wake_pipe[0]))
+            continue;
+
+        if (!receive_available()) {
+            ZLOG_INFO(Network, "Server disconnected");
+            break;
+        }
+    }
+
+    if (_recorder) {
+        ZLOG_INFO(Network, "Recorded %llu chunks (%llu bytes)",
+            (unsigned long long)_recorder->frames(), (unsigned long long)_recorder->bytes());
+        _recorder->close();
+    }
+    _connected = false;
+}
+
+/**
+ * @brief Body of the network thread in replay mode
+ *
+ * Reads the capture one chunk at a time and appends it to the communication
+ * buffer, where it is split and queued exactly like socket data. With a
+ * non-zero speed, each chunk is held until its recorded time, divided by the
+ * speed, has elapsed since the replay started; otherwise chunks are fed as
+ * fast as the ingest thread consumes them. Once the capture is exhausted
+ * and every message delivered, the thread reports itself disconnected.
+ */
+void GUI::NetworkThread::replay_loop()
+{
+    const auto start = std::chrono::steady_clock::now();
+    CaptureFrame frame;
+    bool pending = false;
+    std::uint64_t first = 0;
+    std::uint64_t frames = 0;
+    std::uint64_t bytes = 0;
+
+    while (_running) {
+        discard_outbound();
+
+        if (!split_messages()) {
+            _inbound_stalls.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        if (!pending) {
+            if (!_replay->next_frame(frame))
+                break;
+            if (frames == 0)
+                first = frame.timestamp;
+            pending = true;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (_replay_speed > 0.0) {
+            const auto due = start + std::chrono::nanoseconds(
+                static_cast<std::int64_t>(static_cast<double>(frame.timestamp - first) / _replay_speed));
+            if (now < due) {
+                std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                    due - now, std::chrono::milliseconds(POLL_TIMEOUT_MS)));
+                continue;
+            }
+        }
+
+        _buffer.append_data(std::string_view(frame.data.data(), frame.data.size()));
+        _last_receive = now;
+        frames++;
+        bytes += frame.data.size();
+        pending = false;
+    }
+
+    while (_running && _buffer.has_complete_message()) {
+        if (!split_messages())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (_replay->failed())
+        ZLOG_WARNING(Network, "Capture file is truncated or corrupted, replay stopped early");
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ZLOG_INFO(Network, "Replay finished: %llu chunks (%llu bytes) in %.3f s",
+        (unsigned long long)frames, (unsigned long long)bytes, elapsed.count());
+    _connected = false;
+}
@@ -0,0 +1,155 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** NetworkThread.hpp
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "NetworkManager.hpp"
+#include "SPSCQueue.hpp"
+#include "../communication/CommunicationBuffer.hpp"
+#include "../capture/Capture.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Upper bound on the work done by one ingest step
+     *
+     * Whichever limit is reached first ends the step: the network thread
+     * stops reading the socket, the ingest thread stops processing messages
+     * for the current step.
+     */
+    struct IngestBudget {
+        std::size_t max_bytes = 1024 * 1024;
+        std::chrono::microseconds max_time{4000};
+    };
+
+    struct InboundMessage {
+        std::string line;
+        std::chrono::steady_clock::time_point received;
+    };
+
+    struct NetworkStats {
+        std::size_t inbound_depth = 0;
+        std::size_t outbound_depth = 0;
+        std::uint64_t messages_received = 0;
+        std::uint64_t inbound_stalls = 0;
+        std::uint64_t dropped_commands = 0;
+
+        std::size_t outbound_pending_bytes = 0;
+        std::size_t outbound_peak_bytes = 0;
+        std::uint64_t send_calls = 0;
+        bool congested = false;
+
+        std::size_t kernel_pending_bytes = 0;
+        std::size_t buffered_bytes = 0;
+        std::size_t queued_bytes = 0;
+        double oldest_message_age = 0.0;
+    };
+
+    class NetworkThread {
+        public:
+            static constexpr std::size_t INBOUND_CAPACITY = 65536;
+            static constexpr std::size_t OUTBOUND_CAPACITY = 4096;
+            static constexpr int POLL_TIMEOUT_MS = 5;
+            static constexpr std::size_t READ_CHUNK_SIZE = 16 * 1024;
+            static constexpr std::size_t CLOCK_CHECK_INTERVAL = 32;
+
+            explicit NetworkThread(std::unique_ptr<NetworkManager> manager, IngestBudget budget = {});
+            NetworkThread(std::unique_ptr<CaptureReader> replay, double speed, IngestBudget budget = {});
+            ~NetworkThread();
+
+            NetworkThread(const NetworkThread &) = delete;
+            NetworkThread &operator=(const NetworkThread &) = delete;
+
+            void start();
+            void stop();
+
+            bool record_to(const std::string &path);
+            [[nodiscard]] bool is_replaying() const { return _replay != nullptr; }
+
+            bool send_command(std::string_view command);
+            void flush_commands();
+            [[nodiscard]] bool is_congested() const;
+
+            /**
+             * @brief Hands queued server messages to @p handler
+             *
+             * Never blocks: only the messages already split by the network
+             * thread are delivered, and delivery stops once @p budget is
+             * spent so a large burst is spread over several steps.
+             * Must be called from a single thread.
+             */
+            template <typename Handler>
+            std::size_t drain_messages(Handler &&handler, const IngestBudget &budget)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                std::size_t count = 0;
+                std::size_t bytes = 0;
+
+                for (InboundMessage *message = _inbound.front(); message != nullptr; message = _inbound.front()) {
+                    const std::size_t size = message->line.size();
+                    handler(static_cast<const std::string &>(message->line));
+                    _inbound.pop();
+                    _queued_bytes.fetch_sub(size, std::memory_order_relaxed);
+                    bytes += size;
+                    count++;
+                    if (bytes >= budget.max_bytes)
+                        break;
+                    if (count % CLOCK_CHECK_INTERVAL == 0
+                        && std::chrono::steady_clock::now() - start >= budget.max_time)
+                        break;
+                }
+                return count;
+            }
+
+            [[nodiscard]] bool is_connected() const;
+            [[nodiscard]] bool has_pending_messages() const;
+            [[nodiscard]] NetworkStats get_stats();
+
+        private:
+            void loop();
+            void replay_loop();
+            void flush_outbound();
+            void discard_outbound();
+            void wake();
+            bool split_messages();
+            bool receive_available();
+
+            std::unique_ptr<NetworkManager> _manager;
+            std::unique_ptr<CaptureWriter> _recorder;
+            std::unique_ptr<CaptureReader> _replay;
+            double _replay_speed;
+            std::chrono::steady_clock::time_point _record_start;
+            IngestBudget _budget;
+            CommunicationBuffer _buffer;
+            SPSCQueue<InboundMessage> _inbound;
+            SPSCQueue<std::string> _outbound;
+            std::thread _thread;
+            std::atomic<bool> _running;
+            std::atomic<bool> _connected;
+            std::atomic<bool> _flush_requested;
+            std::atomic<bool> _congested;
+            int _wake_pipe[2];
+            std::chrono::steady_clock::time_point _last_receive;
+
+            std::atomic<std::uint64_t> _messages_received;
+            std::atomic<std::uint64_t> _inbound_stalls;
+            std::atomic<std::uint64_t> _dropped_commands;
+            std::atomic<std::size_t> _kernel_pending_bytes;
+            std::atomic<std::size_t> _buffered_bytes;
+            std::atomic<std::size_t> _queued_bytes;
+            std::atomic<std::size_t> _outbound_pending_bytes;
+            std::atomic<std::size_t> _outbound_peak_bytes;
+            std::atomic<std::uint64_t> _send_calls;
+    };
+} // namespace GUI
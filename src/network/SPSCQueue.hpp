@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** SPSCQueue.hpp
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Bounded lock-free single-producer/single-consumer queue
+     *
+     * Slots are allocated once at construction and reused, so a producer
+     * writing in place through acquire()/publish() never reallocates a
+     * std::string whose capacity is already large enough.
+     *
+     * Exactly one thread may call the producer side (try_push, acquire,
+     * publish) and exactly one other thread the consumer side (front, pop).
+     * size() and empty() may be called from anywhere and are approximate.
+     */
+    template <typename T>
+    class SPSCQueue {
+        public:
+            explicit SPSCQueue(std::size_t capacity)
+                : _slots(capacity), _mask(capacity - 1)
+            {
+                if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+                    throw std::invalid_argument("SPSCQueue capacity must be a power of two");
+            }
+
+            SPSCQueue(const SPSCQueue &) = delete;
+            SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+            /* producer side */
+            [[nodiscard]] T *acquire()
+            {
+                const std::size_t tail = _tail.load(std::memory_order_relaxed);
+                if (tail - _head.load(std::memory_order_acquire) == _slots.size())
+                    return nullptr;
+                return &_slots[tail & _mask];
+            }
+
+            void publish()
+            {
+                _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            template <typename U>
+            bool try_push(U &&value)
+            {
+                T *slot = acquire();
+                if (slot == nullptr)
+                    return false;
+                *slot = std::forward<U>(value);
+                publish();
+                return true;
+            }
+
+            /* consumer side */
+            [[nodiscard]] T *front()
+            {
+                const std::size_t head = _head.load(std::memory_order_relaxed);
+                if (head == _tail.load(std::memory_order_acquire))
+                    return nullptr;
+                return &_slots[head & _mask];
+            }
+
+            void pop()
+            {
+                _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                const std::size_t head = _head.load(std::memory_order_acquire);
+                return _tail.load(std::memory_order_acquire) - head;
+            }
+
+            [[nodiscard]] bool empty() const { return size() == 0; }
+            [[nodiscard]] bool full() const { return size() >= _slots.size(); }
+            [[nodiscard]] std::size_t capacity() const { return _slots.size(); }
+
+        private:
+            std::vector<T> _slots;
+            std::size_t _mask;
+            alignas(64) std::atomic<std::size_t> _head{0};
+            alignas(64) std::atomic<std::size_t> _tail{0};
+    };
+
+} // namespace GUI
@@ -0,0 +1,148 @@
+/**
+ * @file PlayerTable.cpp
+ * @brief Implementation of the PlayerTable class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the PlayerTable class and of its
+ * PlayerColumns storage. Every row operation (append, move, removal, range
+ * copy) is applied to each column in turn, so the columns always have the
+ * same length.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** PlayerTable.cpp
+*/
+
+#include "PlayerTable.hpp"
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @brief Applies @p function to every column of @p tables
+ *
+ * With several tables, @p function receives the matching column of each,
+ * in order. This is the only list of the columns: every row operation
+ * goes through it.
+ */
+template <typename Function, typename... Tables>
+static void for_each_column(Function &&function, Tables &...tables)
+{
+    function(tables.id...);
+    function(tables.x...);
+    function(tables.y...);
+    function(tables.team...);
+    function(tables.orientation...);
+    function(tables.level...);
+    function(tables.stack...);
+    function(tables.flags...);
+    function(tables.inventory...);
+    function(tables.broadcast...);
+    function(tables.broadcastTime...);
+}
+
+/**
+ * @brief Appends a player announced by pnw
+ *
+ * The player has no inventory (until its first pin), no broadcast and
+ * stack rank 0. Coordinates, orientation and level are clamped to their
+ * column types.
+ */
+void GUI::PlayerColumns::pushBack(std::int32_t playerId, int px, int py, std::uint16_t playerTeam,
+    int playerOrientation, int playerLevel)
+{
+    id.push_back(playerId);
+    x.push_back(static_cast<std::uint16_t>(std::clamp(px, 0, 0xFFFF)));
+    y.push_back(static_cast<std::uint16_t>(std::clamp(py, 0, 0xFFFF)));
+    team.push_back(playerTeam);
+    orientation.push_back(static_cast<std::uint8_t>(std::clamp(playerOrientation, 0, 0xFF)));
+    level.push_back(static_cast<std::uint8_t>(std::clamp(playerLevel, 0, 0xFF)));
+    stack.push_back(0);
+    flags.push_back(0);
+    inventory.push_back(Inventory{});
+    broadcast.push_back(StringPool::NONE);
+    broadcastTime.push_back(TimePoint{});
+}
+
+/**
+ * @brief Copies row @p from over row @p to
+ */
+void GUI::PlayerColumns::moveRow(std::size_t from, std::size_t to)
+{
+    for_each_column([from, to](auto &column) { column[to] = column[from]; }, *this);
+}
+
+/**
+ * @brief Removes the last row
+ */
+void GUI::PlayerColumns::popBack()
+{
+    for_each_column([](auto &column) { column.pop_back(); }, *this);
+}
+
+/**
+ * @brief Replaces the content with rows [@p begin, @p end) of @p source
+ */
+void GUI::PlayerColumns::assign(const PlayerColumns &source, std::size_t begin, std::size_t end)
+{
+    const auto first = static_cast<std::ptrdiff_t>(begin);
+    const auto last = static_cast<std::ptrdiff_t>(end);
+
+    for_each_column([first, last](auto &column, const auto &from) {
+        column.assign(from.begin() + first, from.begin() + last);
+    }, *this, source);
+}
+
+/**
+ * @brief Adds a player and returns its handle
+ *
+ * @param id Player number
+ * @param x Column of the player's tile
+ * @param y Row of the player's tile
+ * @param team Team index
+ * @param orientation 1 to 4 (N, E, S, W)
+ * @param level Elevation level
+ */
+GUI::EntityHandle GUI::PlayerTable::insert(std::int32_t id, int x, int y, std::uint16_t team, int orientation, int level)
+{
+    _columns.pushBack(id, x, y, team, orientation, level);
+    return _index.insert();
+}
+
+/**
+ * @brief Removes a player; the last row takes its place
+ *
+ * The broadcast handle of the removed row is not released: the caller owns
+ * the StringPool references.
+ *
+ * @return false if the handle is stale
+ */
+bool GUI::PlayerTable::remove(EntityHandle handle)
+{
+    const std::size_t row = _index.remove(handle);
+    if (row == NPOS)
+        return false;
+
+    if (row != _columns.size() - 1)
+        _columns.moveRow(_columns.size() - 1, row);
+    _columns.popBack();
+    return true;
+}
+
+/**
+ * @brief Returns the memory allocated by the columns and the slot table
+ *
+ * @return Bytes, counting the capacity of each vector rather than its size
+ */
+std::size_t GUI::PlayerTable::getMemoryUsage() const
+{
+    std::size_t bytes = _index.getMemoryUsage();
+
+    for_each_column([&bytes](const auto &column) {
+        bytes += column.capacity() * sizeof(typename std::decay_t<decltype(column)>::value_type);
+    }, _columns);
+    return bytes;
+}
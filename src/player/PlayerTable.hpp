@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** PlayerTable.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../world/SlotIndex.hpp"
+#include "../world/StringPool.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Players stored column by column
+     *
+     * Row i of every column describes the same player. A pass that only
+     * needs positions and teams (drawing) or levels and teams (statistics)
+     * reads those columns and nothing else; a row takes about 40 bytes and
+     * owns no heap memory. The player name is its server number ("#id"), so
+     * only the number is stored, and the broadcast text is a StringPool
+     * handle.
+     *
+     * Used both as the storage of a PlayerTable and as a page of a
+     * WorldSnapshot.
+     */
+    struct PlayerColumns {
+        static constexpr std::size_t INVENTORY_SIZE = 7;
+        static constexpr std::uint8_t INCANTING = 1 << 0;
+        static constexpr std::uint8_t HAS_INVENTORY = 1 << 1;    // a pin was received
+
+        using Quantity = std::uint16_t;
+        using Inventory = std::array<Quantity, INVENTORY_SIZE>;
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        static constexpr std::chrono::seconds BROADCAST_DURATION{3};
+
+        std::vector<std::int32_t> id;
+        std::vector<std::uint16_t> x;
+        std::vector<std::uint16_t> y;
+        std::vector<std::uint16_t> team;            // index in the World's TeamRegistry
+        std::vector<std::uint8_t> orientation;      // 1 to 4: N, E, S, W
+        std::vector<std::uint8_t> level;
+        std::vector<std::uint8_t> stack;            // rank among the players on the same tile
+        std::vector<std::uint8_t> flags;
+        std::vector<Inventory> inventory;
+        std::vector<StringPool::Handle> broadcast;
+        std::vector<TimePoint> broadcastTime;
+
+        [[nodiscard]] std::size_t size() const { return id.size(); }
+        [[nodiscard]] bool has(std::size_t row, std::uint8_t flag) const { return (flags[row] & flag) != 0; }
+        [[nodiscard]] bool showsBroadcast(std::size_t row, TimePoint now) const
+        {
+            return broadcast[row] != StringPool::NONE && now - broadcastTime[row] < BROADCAST_DURATION;
+        }
+
+        void pushBack(std::int32_t playerId, int px, int py, std::uint16_t playerTeam, int playerOrientation, int playerLevel);
+        void moveRow(std::size_t from, std::size_t to);
+        void popBack();
+        void assign(const PlayerColumns &source, std::size_t begin, std::size_t end);
+    };
+
+    /**
+     * @brief Generational table of players with column storage
+     *
+     * Works like a SlotMap<Player> whose values are split over the columns
+     * of a PlayerColumns: rows are kept dense, in no particular order, and
+     * the same SlotIndex maps stable handles to their current row. Removal
+     * moves the last row of every column into the freed one.
+     */
+    class PlayerTable {
+        public:
+            static constexpr std::size_t NPOS = SlotIndex::NPOS;
+
+            EntityHandle insert(std::int32_t id, int x, int y, std::uint16_t team, int orientation, int level);
+            bool remove(EntityHandle handle);
+
+            [[nodiscard]] bool contains(EntityHandle handle) const { return _index.contains(handle); }
+
+            /**
+             * @brief Returns the row of a player, or NPOS if the handle is stale
+             */
+            [[nodiscard]] std::size_t find(EntityHandle handle) const { return _index.find(handle); }
+
+            [[nodiscard]] std::size_t positionOf(EntityHandle handle) const { return _index.positionOf(handle); }
+            [[nodiscard]] std::size_t rowOfSlot(std::uint32_t index) const { return _index.positionOfSlot(index); }
+            [[nodiscard]] EntityHandle handleAt(std::size_t position) const { return _index.handleAt(position); }
+
+            [[nodiscard]] std::size_t size() const { return _index.size(); }
+            [[nodiscard]] bool empty() const { return _index.empty(); }
+            [[nodiscard]] std::size_t getMemoryUsage() const;
+
+            [[nodiscard]] const PlayerColumns &getColumns() const { return _columns; }
+            [[nodiscard]] PlayerColumns &getColumns() { return _columns; }
+
+        private:
+            PlayerColumns _columns;
+            SlotIndex _index;
+    };
+} // namespace GUI
@@ -0,0 +1,379 @@
+/**
+ * @file Protocol.cpp
+ * @brief Implementation of the server message parser for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the parser turning one line of the Zappy graphical
+ * protocol into a typed Protocol::Message. The three-letter opcode is packed
+ * into an integer and looked up in a sorted table of parse functions; numbers
+ * are read with std::from_chars directly from the line. Text fields (team
+ * names, broadcasts, server messages) are views into the line, so parsing a
+ * message never allocates.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Protocol.cpp
+*/
+
+#include "Protocol.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace {
+
+    using namespace GUI::Protocol;
+
+    /**
+     * @brief Reads space separated fields from a line, left to right
+     */
+    class Cursor {
+        public:
+            explicit Cursor(std::string_view text) : _text(text) {}
+
+            bool integer(int &out)
+            {
+                skip_spaces();
+                const char *begin = _text.data() + _pos;
+                const char *end = _text.data() + _text.size();
+                auto [ptr, ec] = std::from_chars(begin, end, out);
+                if (ec != std::errc() || (ptr != end && *ptr != ' '))
+                    return false;
+                _pos += static_cast<std::size_t>(ptr - begin);
+                return true;
+            }
+
+            bool id(int &out)
+            {
+                skip_spaces();
+                if (_pos < _text.size() && _text[_pos] == '#')
+                    _pos++;
+                return integer(out);
+            }
+
+            bool word(std::string_view &out)
+            {
+                skip_spaces();
+                const std::size_t end = std::min(_text.find(' ', _pos), _text.size());
+                if (end == _pos)
+                    return false;
+                out = _text.substr(_pos, end - _pos);
+                _pos = end;
+                return true;
+            }
+
+            bool resources(Resources &out)
+            {
+                for (int &quantity : out) {
+                    if (!integer(quantity))
+                        return false;
+                }
+                return true;
+            }
+
+            std::string_view rest()
+            {
+                if (_pos < _text.size() && _text[_pos] == ' ')
+                    _pos++;
+                return _text.substr(_pos);
+            }
+
+        private:
+            void skip_spaces()
+            {
+                while (_pos < _text.size() && _text[_pos] == ' ')
+                    _pos++;
+            }
+
+            std::string_view _text;
+            std::size_t _pos = 0;
+    };
+
+    /* Parse functions receive the cursor positioned after the opcode and
+       return Invalid when a field is missing or malformed. */
+
+    Message parse_msz(Cursor &in, std::string_view line)
+    {
+        MapSize m{};
+        if (!in.integer(m.width) || !in.integer(m.height))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_bct(Cursor &in, std::string_view line)
+    {
+        TileContent m{};
+        if (!in.integer(m.x) || !in.integer(m.y) || !in.resources(m.resources))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_tna(Cursor &in, std::string_view line)
+    {
+        TeamName m{};
+        if (!in.word(m.name))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pnw(Cursor &in, std::string_view line)
+    {
+        PlayerNew m{};
+        if (!in.id(m.id) || !in.integer(m.x) || !in.integer(m.y)
+            || !in.integer(m.orientation) || !in.integer(m.level) || !in.word(m.team))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_ppo(Cursor &in, std::string_view line)
+    {
+        PlayerPosition m{};
+        if (!in.id(m.id) || !in.integer(m.x) || !in.integer(m.y) || !in.integer(m.orientation))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_plv(Cursor &in, std::string_view line)
+    {
+        PlayerLevel m{};
+        if (!in.id(m.id) || !in.integer(m.level))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pin(Cursor &in, std::string_view line)
+    {
+        PlayerInventory m{};
+        if (!in.id(m.id) || !in.integer(m.x) || !in.integer(m.y) || !in.resources(m.resources))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pex(Cursor &in, std::string_view line)
+    {
+        PlayerExpulsion m{};
+        if (!in.id(m.id))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pbc(Cursor &in, std::string_view line)
+    {
+        PlayerBroadcast m{};
+        if (!in.id(m.id))
+            return Invalid{line};
+        m.message = in.rest();
+        return m;
+    }
+
+    Message parse_pic(Cursor &in, std::string_view line)
+    {
+        IncantationStart m{};
+        if (!in.integer(m.x) || !in.integer(m.y) || !in.integer(m.level))
+            return Invalid{line};
+        m.players = in.rest();
+        return m;
+    }
+
+    Message parse_pie(Cursor &in, std::string_view line)
+    {
+        IncantationEnd m{};
+        if (!in.integer(m.x) || !in.integer(m.y) || !in.integer(m.result))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pfk(Cursor &in, std::string_view line)
+    {
+        PlayerFork m{};
+        if (!in.id(m.id))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pdr(Cursor &in, std::string_view line)
+    {
+        ResourceDrop m{};
+        if (!in.id(m.id) || !in.integer(m.resource))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pgt(Cursor &in, std::string_view line)
+    {
+        ResourceCollect m{};
+        if (!in.id(m.id) || !in.integer(m.resource))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_pdi(Cursor &in, std::string_view line)
+    {
+        PlayerDeath m{};
+        if (!in.id(m.id))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_enw(Cursor &in, std::string_view line)
+    {
+        EggNew m{};
+        if (!in.id(m.egg) || !in.id(m.player) || !in.integer(m.x) || !in.integer(m.y))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_ebo(Cursor &in, std::string_view line)
+    {
+        EggHatch m{};
+        if (!in.id(m.egg))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_edi(Cursor &in, std::string_view line)
+    {
+        EggDeath m{};
+        if (!in.id(m.egg))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_sgt(Cursor &in, std::string_view line)
+    {
+        TimeUnit m{};
+        if (!in.integer(m.frequency))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_seg(Cursor &in, std::string_view line)
+    {
+        GameEnd m{};
+        if (!in.word(m.team))
+            return Invalid{line};
+        return m;
+    }
+
+    Message parse_smg(Cursor &in, std::string_view)
+    {
+        return ServerText{in.rest()};
+    }
+
+    Message parse_suc(Cursor &, std::string_view)
+    {
+        return UnknownCommand{};
+    }
+
+    Message parse_sbp(Cursor &, std::string_view)
+    {
+        return BadParameters{};
+    }
+
+    struct Entry {
+        std::uint32_t code;
+        Message (*parse)(Cursor &, std::string_view);
+    };
+
+    /* Sorted by packed opcode (third letter first) for the binary search. */
+    constexpr Entry TABLE[] = {
+        {opcode('t', 'n', 'a'), parse_tna},
+        {opcode('p', 'b', 'c'), parse_pbc},
+        {opcode('p', 'i', 'c'), parse_pic},
+        {opcode('s', 'u', 'c'), parse_suc},
+        {opcode('p', 'i', 'e'), parse_pie},
+        {opcode('s', 'e', 'g'), parse_seg},
+        {opcode('s', 'm', 'g'), parse_smg},
+        {opcode('e', 'd', 'i'), parse_edi},
+        {opcode('p', 'd', 'i'), parse_pdi},
+        {opcode('p', 'f', 'k'), parse_pfk},
+        {opcode('p', 'i', 'n'), parse_pin},
+        {opcode('e', 'b', 'o'), parse_ebo},
+        {opcode('p', 'p', 'o'), parse_ppo},
+        {opcode('s', 'b', 'p'), parse_sbp},
+        {opcode('p', 'd', 'r'), parse_pdr},
+        {opcode('b', 'c', 't'), parse_bct},
+        {opcode('p', 'g', 't'), parse_pgt},
+        {opcode('s', 'g', 't'), parse_sgt},
+        {opcode('p', 'l', 'v'), parse_plv},
+        {opcode('e', 'n', 'w'), parse_enw},
+        {opcode('p', 'n', 'w'), parse_pnw},
+        {opcode('p', 'e', 'x'), parse_pex},
+        {opcode('m', 's', 'z'), parse_msz},
+    };
+
+    constexpr bool is_sorted_table()
+    {
+        for (std::size_t i = 1; i < std::size(TABLE); i++) {
+            if (TABLE[i - 1].code >= TABLE[i].code)
+                return false;
+        }
+        return true;
+    }
+
+    static_assert(is_sorted_table(), "protocol table must be sorted by packed opcode");
+
+} // namespace
+
+/**
+ * @brief Parses one line of the graphical protocol
+ *
+ * The first three characters are packed into an integer and looked up in the
+ * opcode table; the matching function reads the remaining fields. Fields
+ * after the expected ones are ignored, as the server may append extra data.
+ *
+ * @param line One server message, without the trailing newline
+ * @return Message The typed message, or Invalid if the opcode is unknown or
+ *         a field is missing or not a number
+ *
+ * @note Text fields of the result are views into @p line
+ * @note Never allocates
+ */
+GUI::Protocol::Message GUI::Protocol::parse(std::string_view line)
+{
+    if (line.size() < 3 || (line.size() > 3 && line[3] != ' '))
+        return Invalid{line};
+
+    const std::uint32_t code = opcode(line[0], line[1], line[2]);
+    const Entry *end = std::end(TABLE);
+    const Entry *entry = std::lower_bound(std::begin(TABLE), end, code,
+        [](const Entry &e, std::uint32_t value) { return e.code < value; });
+    if (entry == end || entry->code != code)
+        return Invalid{line};
+
+    Cursor cursor(line.substr(3));
+    return entry->parse(cursor, line);
+}
+
+/**
+ * @brief Reads the next player id from a space separated id list
+ *
+ * Used to walk the player list of an IncantationStart message. Tokens that
+ * are not ids are skipped.
+ *
+ * @param list Remaining list; advanced past the id read
+ * @param id Receives the id, without its leading '#'
+ * @return true if an id was read, false once the list is exhausted
+ */
+bool GUI::Protocol::next_id(std::string_view &list, int &id)
+{
+    while (!list.empty()) {
+        const std::size_t start = list.find_first_not_of(' ');
+        if (start == std::string_view::npos)
+            break;
+        const std::size_t end = std::min(list.find(' ', start), list.size());
+        std::string_view token = list.substr(start, end - start);
+        list.remove_prefix(end);
+
+        if (token[0] == '#')
+            token.remove_prefix(1);
+        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), id);
+        if (ec == std::errc() && ptr == token.data() + token.size())
+            return true;
+    }
+    list = {};
+    return false;
+}
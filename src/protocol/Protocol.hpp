@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** Protocol.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <variant>
+
+namespace GUI::Protocol {
+
+    using Resources = std::array<int, 7>;
+
+    struct Invalid { std::string_view line; };
+    struct MapSize { int width; int height; };
+    struct TileContent { int x; int y; Resources resources; };
+    struct TeamName { std::string_view name; };
+    struct PlayerNew { int id; int x; int y; int orientation; int level; std::string_view team; };
+    struct PlayerPosition { int id; int x; int y; int orientation; };
+    struct PlayerLevel { int id; int level; };
+    struct PlayerInventory { int id; int x; int y; Resources resources; };
+    struct PlayerExpulsion { int id; };
+    struct PlayerBroadcast { int id; std::string_view message; };
+    struct IncantationStart { int x; int y; int level; std::string_view players; };
+    struct IncantationEnd { int x; int y; int result; };
+    struct PlayerFork { int id; };
+    struct ResourceDrop { int id; int resource; };
+    struct ResourceCollect { int id; int resource; };
+    struct PlayerDeath { int id; };
+    struct EggNew { int egg; int player; int x; int y; };
+    struct EggHatch { int egg; };
+    struct EggDeath { int egg; };
+    struct TimeUnit { int frequency; };
+    struct GameEnd { std::string_view team; };
+    struct ServerText { std::string_view text; };
+    struct UnknownCommand {};
+    struct BadParameters {};
+
+    /**
+     * @brief One parsed server message
+     *
+     * Text fields are views into the parsed line: a Message must not outlive
+     * the line it was parsed from. Constructing one never allocates.
+     */
+    using Message = std::variant<Invalid, MapSize, TileContent, TeamName, PlayerNew,
+        PlayerPosition, PlayerLevel, PlayerInventory, PlayerExpulsion, PlayerBroadcast,
+        IncantationStart, IncantationEnd, PlayerFork, ResourceDrop, ResourceCollect,
+        PlayerDeath, EggNew, EggHatch, EggDeath, TimeUnit, GameEnd, ServerText,
+        UnknownCommand, BadParameters>;
+
+    /**
+     * @brief Packs a three-letter opcode into an integer
+     */
+    constexpr std::uint32_t opcode(char a, char b, char c)
+    {
+        return static_cast<std::uint32_t>(static_cast<unsigned char>(a))
+            | (static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8)
+            | (static_cast<std::uint32_t>(static_cast<unsigned char>(c)) << 16);
+    }
+
+    Message parse(std::string_view line);
+    bool next_id(std::string_view &list, int &id);
+
+} // namespace GUI::Protocol
@@ -0,0 +1,350 @@
+/**
+ * @file RefreshScheduler.cpp
+ * @brief Implementation of the RefreshScheduler class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the RefreshScheduler class which
+ * replaces the per-frame ppo flood with a bounded, adaptive stream of queries.
+ * Every query kind (ppo, plv, pin, bct) owns a token bucket refilled at a rate
+ * expressed in queries per server time unit; tokens are spent on the stalest
+ * entities of a round-robin window, skipping those the server already pushed.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZappyGUI
+** File description:
+** RefreshScheduler.cpp
+*/
+
+#include "RefreshScheduler.hpp"
+#include <algorithm>
+
+/**
+ * @brief Picks the stalest entities of a round-robin window
+ *
+ * Scans a window of entities starting at the cursor, keeps those older than
+ * the minimum age and moves the budget stalest of them (ties broken by
+ * round-robin order) to the front of the candidate list. The cursor moves to
+ * the first stale entity left unserved, or past the window when all were
+ * served, so no stale entity is skipped.
+ *
+ * @param candidates Scratch list, filled with the selection on return
+ * @param cursor Round-robin position, updated
+ * @param count Number of entities
+ * @param budget Maximum number of entities to select
+ * @param now Current time in seconds
+ * @param minAge Minimum age in seconds for an entity to be selected
+ * @param freshAt Returns the last refresh time of an entity index
+ * @return Number of selected entities (the first ones of candidates)
+ */
+template <typename FreshAt>
+static std::size_t select_stalest(std::vector<GUI::RefreshCandidate> &candidates,
+    std::size_t &cursor, std::size_t count, std::size_t budget, float now,
+    float minAge, FreshAt &&freshAt)
+{
+    candidates.clear();
+    if (count == 0 || budget == 0)
+        return 0;
+
+    cursor %= count;
+    const std::size_t window = std::min(count,
+        std::max(budget * 4, GUI::RefreshScheduler::MIN_SCAN_WINDOW));
+
+    for (std::size_t order = 0; order < window; ++order) {
+        const std::size_t index = (cursor + order) % count;
+        const float fresh = freshAt(index);
+        if (now - fresh >= minAge)
+            candidates.push_back({fresh, order, index});
+    }
+
+    const std::size_t selected = std::min(budget, candidates.size());
+    auto byStaleness = [](const GUI::RefreshCandidate &a, const GUI::RefreshCandidate &b) {
+        return a.fresh < b.fresh || (a.fresh == b.fresh && a.order < b.order);
+    };
+    std::nth_element(candidates.begin(),
+        candidates.begin() + static_cast<std::ptrdiff_t>(selected), candidates.end(), byStaleness);
+
+    std::size_t advance = window;
+    for (std::size_t i = selected; i < candidates.size(); ++i)
+        advance = std::min(advance, candidates[i].order);
+    cursor = (cursor + advance) % count;
+    return selected;
+}
+
+/**
+ * @brief Constructs a scheduler with the default query policies
+ *
+ * Default policies, in queries per time unit / minimum age in time units:
+ * - ppo: 0.5 / 7 (a move takes 7 time units)
+ * - plv: 0.1 / 300 (elevations are rare and pushed by the server)
+ * - pin: 0.025 / 126 (pgt and pdr are applied locally; pin only reconciles)
+ * - bct: 0.1 / 126 (pgt and pdr are applied locally; bct reconciles and
+ *   picks up respawns, which happen every 20 time units map-wide)
+ *
+ * The time unit defaults to 100 until setTimeUnit() is called.
+ */
+GUI::RefreshScheduler::RefreshScheduler()
+    : _epoch(std::chrono::steady_clock::now()), _lastCollect(0.0),
+      _frequency(100), _width(0), _height(0)
+{
+    _kinds[static_cast<std::size_t>(QueryKind::Position)].policy = {0.5, 7.0};
+    _kinds[static_cast<std::size_t>(QueryKind::Level)].policy = {0.1, 300.0};
+    _kinds[static_cast<std::size_t>(QueryKind::Inventory)].policy = {0.025, 126.0};
+    _kinds[static_cast<std::size_t>(QueryKind::Tile)].policy = {0.1, 126.0};
+}
+
+/**
+ * @brief Sets the server frequency reported by sgt
+ *
+ * @param frequency Number of time units per second
+ *
+ * @note Non-positive values are ignored
+ */
+void GUI::RefreshScheduler::setTimeUnit(int frequency)
+{
+    if (frequency > 0)
+        _frequency = frequency;
+}
+
+/**
+ * @brief Overrides the rate and minimum age of a query kind
+ *
+ * @param kind Query kind to configure
+ * @param policy Queries per time unit and minimum age in time units
+ */
+void GUI::RefreshScheduler::setPolicy(QueryKind kind, QueryPolicy policy)
+{
+    _kinds[static_cast<std::size_t>(kind)].policy = policy;
+}
+
+/**
+ * @brief Sets the map size used for tile refreshes
+ *
+ * Every tile starts as fresh: the initial mct already covers them.
+ *
+ * @param width Map width in tiles
+ * @param height Map height in tiles
+ */
+void GUI::RefreshScheduler::setMapSize(int width, int height)
+{
+    _width = std::max(width, 0);
+    _height = std::max(height, 0);
+    _tileFresh.assign(static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height), elapsed());
+    _kinds[static_cast<std::size_t>(QueryKind::Tile)].cursor = 0;
+}
+
+/**
+ * @brief Starts tracking a player
+ *
+ * The player is considered fresh for every kind, as pnw carries its
+ * position and level.
+ *
+ * @param id Numeric player id (the n of #n)
+ */
+void GUI::RefreshScheduler::addPlayer(int id)
+{
+    if (_playerIndex.find(id) != _playerIndex.end())
+        return;
+
+    TrackedPlayer player{id, {}};
+    player.fresh.fill(elapsed());
+    _playerIndex[id] = _players.size();
+    _players.push_back(player);
+}
+
+/**
+ * @brief Stops tracking a player
+ *
+ * @param id Numeric player id
+ */
+void GUI::RefreshScheduler::removePlayer(int id)
+{
+    auto it = _playerIndex.find(id);
+    if (it == _playerIndex.end())
+        return;
+
+    const std::size_t index = it->second;
+    _playerIndex.erase(it);
+    if (index + 1 != _players.size()) {
+        _players[index] = _players.back();
+        _playerIndex[_players[index].id] = index;
+    }
+    _players.pop_back();
+}
+
+/**
+ * @brief Records that the server just sent up-to-date player data
+ *
+ * Called for replies to our queries and for messages the server pushes on
+ * its own, so players that are already kept up to date are not queried.
+ *
+ * @param kind Kind of data received
+ * @param id Numeric player id
+ */
+void GUI::RefreshScheduler::markPlayerFresh(QueryKind kind, int id)
+{
+    auto it = _playerIndex.find(id);
+    if (it != _playerIndex.end())
+        _players[it->second].fresh[static_cast<std::size_t>(kind)] = elapsed();
+}
+
+/**
+ * @brief Records that the server just sent the content of a tile
+ *
+ * @param x Tile column
+ * @param y Tile row
+ */
+void GUI::RefreshScheduler::markTileFresh(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height)
+        return;
+    _tileFresh[static_cast<std::size_t>(y) * static_cast<std::size_t>(_width) + static_cast<std::size_t>(x)] = elapsed();
+}
+
+/**
+ * @brief Appends the queries allowed since the previous call
+ *
+ * Refills every token bucket for the elapsed time and spends whole tokens on
+ * the stalest entities. Meant to be called once per frame; the number of
+ * queries only depends on elapsed time and policies, not on the frame rate
+ * or on the number of players.
+ *
+ * @param out Vector receiving the queries (not cleared)
+ * @return Number of queries appended
+ */
+std::size_t GUI::RefreshScheduler::collect(std::vector<Query> &out)
+{
+    const float now = elapsed();
+    const double delta = std::max(0.0, static_cast<double>(now) - _lastCollect);
+    std::size_t total = 0;
+
+    _lastCollect = now;
+    for (auto &state : _kinds)
+        refill(state, delta);
+
+    total += collectPlayers(QueryKind::Position, out, now);
+    total += collectPlayers(QueryKind::Level, out, now);
+    total += collectPlayers(QueryKind::Inventory, out, now);
+    total += collectTiles(out, now);
+    return total;
+}
+
+/**
+ * @brief Returns the query rate actually achieved for a kind
+ *
+ * @param kind Query kind
+ * @return double Queries per second measured over the last second
+ */
+double GUI::RefreshScheduler::getAchievedRate(QueryKind kind) const
+{
+    return _kinds[static_cast<std::size_t>(kind)].achievedRate;
+}
+
+/**
+ * @brief Returns the time elapsed since the scheduler was created
+ *
+ * @return float Seconds since construction
+ */
+float GUI::RefreshScheduler::elapsed() const
+{
+    std::chrono::duration<float> duration = std::chrono::steady_clock::now() - _epoch;
+    return duration.count();
+}
+
+/**
+ * @brief Converts a kind's policy to queries per second
+ *
+ * @param state Kind state holding the policy
+ * @return double Allowed queries per second, capped at MAX_QUERIES_PER_SECOND
+ */
+double GUI::RefreshScheduler::ratePerSecond(const KindState &state) const
+{
+    return std::min(state.policy.per_time_unit * _frequency, MAX_QUERIES_PER_SECOND);
+}
+
+/**
+ * @brief Adds the tokens earned during the elapsed time
+ *
+ * Unused tokens are capped to a tenth of a second worth of queries, so a
+ * quiet period is not followed by a burst.
+ *
+ * @param state Kind state to refill
+ * @param elapsed Seconds since the previous refill
+ */
+void GUI::RefreshScheduler::refill(KindState &state, double elapsed)
+{
+    const double rate = ratePerSecond(state);
+    state.tokens = std::min(state.tokens + rate * elapsed, std::max(1.0, rate * 0.1));
+}
+
+/**
+ * @brief Updates the achieved rate measurement of a kind
+ *
+ * @param state Kind state
+ * @param sent Number of queries sent by this collect
+ * @param now Current time in seconds
+ */
+void GUI::RefreshScheduler::account(KindState &state, std::size_t sent, double now)
+{
+    state.tokens -= static_cast<double>(sent);
+    state.windowCount += sent;
+    if (now - state.windowStart >= 1.0) {
+        state.achievedRate = static_cast<double>(state.windowCount) / (now - state.windowStart);
+        state.windowCount = 0;
+        state.windowStart = now;
+    }
+}
+
+/**
+ * @brief Selects the player queries of one kind
+ *
+ * @param kind Position, Level or Inventory
+ * @param out Vector receiving the queries
+ * @param now Current time in seconds
+ * @return Number of queries appended
+ */
+std::size_t GUI::RefreshScheduler::collectPlayers(QueryKind kind, std::vector<Query> &out, float now)
+{
+    KindState &state = _kinds[static_cast<std::size_t>(kind)];
+    const auto slot = static_cast<std::size_t>(kind);
+    const auto minAge = static_cast<float>(state.policy.min_age / _frequency);
+    const std::size_t selected = select_stalest(_candidates, state.cursor, _players.size(),
+        static_cast<std::size_t>(state.tokens), now, minAge,
+        [this, slot](std::size_t index) { return _players[index].fresh[slot]; });
+
+    for (std::size_t i = 0; i < selected; ++i) {
+        TrackedPlayer &player = _players[_candidates[i].index];
+        player.fresh[slot] = now;
+        out.push_back({kind, player.id, 0, 0});
+    }
+    account(state, selected, now);
+    return selected;
+}
+
+/**
+ * @brief Selects the bct queries
+ *
+ * @param out Vector receiving the queries
+ * @param now Current time in seconds
+ * @return Number of queries appended
+ */
+std::size_t GUI::RefreshScheduler::collectTiles(std::vector<Query> &out, float now)
+{
+    KindState &state = _kinds[static_cast<std::size_t>(QueryKind::Tile)];
+    const auto minAge = static_cast<float>(state.policy.min_age / _frequency);
+    const std::size_t selected = select_stalest(_candidates, state.cursor, _tileFresh.size(),
+        static_cast<std::size_t>(state.tokens), now, minAge,
+        [this](std::size_t index) { return _tileFresh[index]; });
+
+    for (std::size_t i = 0; i < selected; ++i) {
+        const std::size_t index = _candidates[i].index;
+        _tileFresh[index] = now;
+        out.push_back({QueryKind::Tile, 0,
+            static_cast<int>(index % static_cast<std::size_t>(_width)),
+            static_cast<int>(index / static_cast<std::size_t>(_width))});
+    }
+    account(state, selected, now);
+    return selected;
+}
@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** RefreshScheduler.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace GUI {
+
+    enum class QueryKind {
+        Position = 0,   // ppo #n
+        Level,          // plv #n
+        Inventory,      // pin #n
+        Tile,           // bct X Y
+        Count
+    };
+
+    struct Query {
+        QueryKind kind;
+        int id;         // player id for player queries
+        int x;          // tile coordinates for Tile queries
+        int y;
+    };
+
+    struct RefreshCandidate {
+        float fresh;
+        std::size_t order;
+        std::size_t index;
+    };
+
+    struct QueryPolicy {
+        double per_time_unit;   // queries allowed per server time unit
+        double min_age;         // never re-query something fresher than this (time units)
+    };
+
+    /**
+     * @brief Decides which periodic ppo/plv/pin/bct queries to send
+     *
+     * Each query kind has a token bucket refilled at a rate expressed per
+     * server time unit, so the number of queries per second stays bounded
+     * whatever the number of players or tiles. Tokens are spent on a window
+     * of entities taken in round-robin order, stalest first; entities that
+     * the server refreshed on its own (movement, level up...) are marked
+     * fresh and skipped.
+     */
+    class RefreshScheduler {
+        public:
+            static constexpr std::size_t KIND_COUNT = static_cast<std::size_t>(QueryKind::Count);
+            static constexpr double MAX_QUERIES_PER_SECOND = 200.0;
+            static constexpr std::size_t MIN_SCAN_WINDOW = 64;
+
+            RefreshScheduler();
+
+            void setTimeUnit(int frequency);
+            void setPolicy(QueryKind kind, QueryPolicy policy);
+            void setMapSize(int width, int height);
+
+            void addPlayer(int id);
+            void removePlayer(int id);
+            void markPlayerFresh(QueryKind kind, int id);
+            void markTileFresh(int x, int y);
+
+            std::size_t collect(std::vector<Query> &out);
+
+            [[nodiscard]] double getAchievedRate(QueryKind kind) const;
+
+        private:
+            struct TrackedPlayer {
+                int id;
+                std::array<float, KIND_COUNT> fresh;
+            };
+
+            struct KindState {
+                QueryPolicy policy;
+                double tokens = 0.0;
+                std::size_t cursor = 0;
+                std::size_t windowCount = 0;
+                double windowStart = 0.0;
+                double achievedRate = 0.0;
+            };
+
+            [[nodiscard]] float elapsed() const;
+            [[nodiscard]] double ratePerSecond(const KindState &state) const;
+            void refill(KindState &state, double elapsed);
+            void account(KindState &state, std::size_t sent, double now);
+            std::size_t collectPlayers(QueryKind kind, std::vector<Query> &out, float now);
+            std::size_t collectTiles(std::vector<Query> &out, float now);
+
+            std::chrono::steady_clock::time_point _epoch;
+            double _lastCollect;
+            int _frequency;
+            int _width;
+            int _height;
+
+            std::array<KindState, KIND_COUNT> _kinds;
+            std::vector<TrackedPlayer> _players;
+            std::unordered_map<int, std::size_t> _playerIndex;
+            std::vector<float> _tileFresh;
+
+            std::vector<RefreshCandidate> _candidates;
+    };
+} // namespace GUI
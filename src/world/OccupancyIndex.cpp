@@ -0,0 +1,102 @@
+/**
+ * @file OccupancyIndex.cpp
+ * @brief Implementation of the OccupancyIndex class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the OccupancyIndex class, the
+ * tile to entities index kept up to date on pnw, ppo, pdi, enw, ebo and edi.
+ * Every operation touches a constant number of links.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** OccupancyIndex.cpp
+*/
+
+#include "OccupancyIndex.hpp"
+
+/**
+ * @brief Sizes the index for a map and unlinks every entity
+ *
+ * @param tiles Number of tiles of the map
+ */
+void GUI::OccupancyIndex::resize(std::size_t tiles)
+{
+    _tiles.assign(tiles, Tile{});
+    _links.assign(_links.size(), Link{});
+}
+
+/**
+ * @brief Links an entity at the end of a tile's list
+ *
+ * @param slot Slot index of the entity; must not be linked already
+ * @param tile Tile index
+ */
+void GUI::OccupancyIndex::insert(std::uint32_t slot, std::size_t tile)
+{
+    if (slot >= _links.size())
+        _links.resize(static_cast<std::size_t>(slot) + 1);
+
+    Tile &entry = _tiles[tile];
+    Link &link = _links[slot];
+    link.tile = static_cast<std::uint32_t>(tile);
+    link.prev = entry.tail;
+    link.next = NONE;
+    link.rank = entry.count;
+
+    if (entry.tail != NONE)
+        _links[entry.tail].next = slot;
+    else
+        entry.head = slot;
+    entry.tail = slot;
+    entry.count++;
+}
+
+/**
+ * @brief Unlinks an entity from its tile
+ *
+ * The tile's last entity takes the place and the rank of the removed one.
+ *
+ * @param slot Slot index of the entity; ignored if not linked
+ * @return Slot index of the entity whose rank changed, or NONE
+ */
+std::uint32_t GUI::OccupancyIndex::remove(std::uint32_t slot)
+{
+    if (!contains(slot))
+        return NONE;
+
+    Link &link = _links[slot];
+    Tile &entry = _tiles[link.tile];
+    std::uint32_t moved = NONE;
+
+    if (entry.tail != slot) {
+        moved = entry.tail;
+        Link &last = _links[moved];
+        _links[last.prev].next = NONE;
+        entry.tail = last.prev;
+
+        last.prev = link.prev;
+        last.next = link.next;
+        last.rank = link.rank;
+        if (link.prev != NONE)
+            _links[link.prev].next = moved;
+        else
+            entry.head = moved;
+        if (link.next != NONE)
+            _links[link.next].prev = moved;
+        else
+            entry.tail = moved;
+    } else {
+        if (link.prev != NONE)
+            _links[link.prev].next = NONE;
+        else
+            entry.head = NONE;
+        entry.tail = link.prev;
+    }
+    entry.count--;
+    link = Link{};
+    return moved;
+}
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** OccupancyIndex.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Entities standing on each tile
+     *
+     * Entities are identified by their slot index in a SlotMap. Each tile
+     * heads an intrusive doubly linked list threaded through a per-slot link
+     * array, so no list allocates, linking or unlinking an entity is O(1) and
+     * listing a tile is O(k) in the number of entities on it.
+     *
+     * Each linked entity also has a rank on its tile, from 0 to count - 1,
+     * in list order: removing an entity moves the tile's last entity into its
+     * place, so ranks stay contiguous (used to stack entities side by side).
+     */
+    class OccupancyIndex {
+        public:
+            static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+            void resize(std::size_t tiles);
+
+            void insert(std::uint32_t slot, std::size_t tile);
+            std::uint32_t remove(std::uint32_t slot);
+
+            [[nodiscard]] bool contains(std::uint32_t slot) const
+            {
+                return slot < _links.size() && _links[slot].tile != NONE;
+            }
+
+            [[nodiscard]] std::uint32_t getTile(std::uint32_t slot) const { return _links[slot].tile; }
+            [[nodiscard]] std::uint32_t getRank(std::uint32_t slot) const { return _links[slot].rank; }
+            [[nodiscard]] std::uint32_t count(std::size_t tile) const { return _tiles[tile].count; }
+
+            template <typename Function>
+            void forEach(std::size_t tile, Function &&function) const
+            {
+                for (std::uint32_t slot = _tiles[tile].head; slot != NONE; slot = _links[slot].next)
+                    function(slot);
+            }
+
+        private:
+            struct Tile {
+                std::uint32_t head = NONE;
+                std::uint32_t tail = NONE;
+                std::uint32_t count = 0;
+            };
+
+            struct Link {
+                std::uint32_t tile = NONE;
+                std::uint32_t prev = NONE;
+                std::uint32_t next = NONE;
+                std::uint32_t rank = 0;
+            };
+
+            std::vector<Tile> _tiles;
+            std::vector<Link> _links;
+    };
+} // namespace GUI
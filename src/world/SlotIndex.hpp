@@ -0,0 +1,159 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** SlotIndex.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Reference to an entity stored in a SlotMap
+     *
+     * The generation changes every time the slot is freed, so a handle kept
+     * after its entity was removed no longer resolves, even if the slot was
+     * reused since.
+     */
+    struct EntityHandle {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        std::uint32_t index = INVALID_INDEX;
+        std::uint32_t generation = 0;
+
+        [[nodiscard]] bool valid() const { return index != INVALID_INDEX; }
+        bool operator==(const EntityHandle &other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Maps generational handles to the rows of a dense container
+     *
+     * Holds no values: the owner keeps them in one or more arrays indexed by
+     * row, and mirrors every change of the index. insert() stands for a row
+     * appended at the end. remove() frees the slot and moves the last row's
+     * handle into the removed row; the owner then moves its last row into
+     * that row and pops the last one, so rows stay dense and in step with
+     * the index. Freed slots are chained in a free list through their
+     * position field.
+     */
+    class SlotIndex {
+        public:
+            static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+            /**
+             * @brief Gives a handle to a new row, appended at size()
+             */
+            EntityHandle insert()
+            {
+                std::uint32_t index;
+                if (_freeHead != EntityHandle::INVALID_INDEX) {
+                    index = _freeHead;
+                    _freeHead = _slots[index].position;
+                } else {
+                    index = static_cast<std::uint32_t>(_slots.size());
+                    _slots.push_back(Slot{});
+                }
+
+                Slot &slot = _slots[index];
+                slot.position = static_cast<std::uint32_t>(_owners.size());
+                _owners.push_back(index);
+                return EntityHandle{index, slot.generation};
+            }
+
+            /**
+             * @brief Frees the slot of a handle
+             *
+             * The owner must then move its last row into the returned row
+             * (unless it is the last one) and pop its last row.
+             *
+             * @return The row the entity occupied, or NPOS if the handle is stale
+             */
+            std::size_t remove(EntityHandle handle)
+            {
+                if (!contains(handle))
+                    return NPOS;
+
+                Slot &slot = _slots[handle.index];
+                const std::uint32_t position = slot.position;
+                const std::uint32_t last = static_cast<std::uint32_t>(_owners.size() - 1);
+                if (position != last) {
+                    _owners[position] = _owners[last];
+                    _slots[_owners[position]].position = position;
+                }
+                _owners.pop_back();
+
+                slot.generation++;
+                slot.position = _freeHead;
+                _freeHead = handle.index;
+                return position;
+            }
+
+            [[nodiscard]] bool contains(EntityHandle handle) const
+            {
+                return handle.index < _slots.size() && _slots[handle.index].generation == handle.generation
+                    && _slots[handle.index].position < _owners.size()
+                    && _owners[_slots[handle.index].position] == handle.index;
+            }
+
+            /**
+             * @brief Returns the row of a handle, or NPOS if the handle is stale
+             */
+            [[nodiscard]] std::size_t find(EntityHandle handle) const
+            {
+                return contains(handle) ? _slots[handle.index].position : NPOS;
+            }
+
+            [[nodiscard]] std::size_t positionOf(EntityHandle handle) const { return _slots[handle.index].position; }
+            [[nodiscard]] std::size_t positionOfSlot(std::uint32_t index) const { return _slots[index].position; }
+
+            [[nodiscard]] EntityHandle handleForSlot(std::uint32_t index) const
+            {
+                return EntityHandle{index, _slots[index].generation};
+            }
+
+            [[nodiscard]] EntityHandle handleAt(std::size_t position) const
+            {
+                const std::uint32_t index = _owners[position];
+                return EntityHandle{index, _slots[index].generation};
+            }
+
+            /**
+             * @brief Frees every slot; the owner clears its rows
+             */
+            void clear()
+            {
+                for (std::uint32_t index : _owners) {
+                    Slot &slot = _slots[index];
+                    slot.generation++;
+                    slot.position = _freeHead;
+                    _freeHead = index;
+                }
+                _owners.clear();
+            }
+
+            [[nodiscard]] std::size_t size() const { return _owners.size(); }
+            [[nodiscard]] bool empty() const { return _owners.empty(); }
+            [[nodiscard]] std::size_t slotCount() const { return _slots.size(); }
+
+            [[nodiscard]] std::size_t getMemoryUsage() const
+            {
+                return _owners.capacity() * sizeof(std::uint32_t) + _slots.capacity() * sizeof(Slot);
+            }
+
+        private:
+            struct Slot {
+                std::uint32_t position = 0;     // dense row, or next free slot
+                std::uint32_t generation = 0;
+            };
+
+            std::vector<std::uint32_t> _owners;    // slot index of each row
+            std::vector<Slot> _slots;
+            std::uint32_t _freeHead = EntityHandle::INVALID_INDEX;
+    };
+} // namespace GUI
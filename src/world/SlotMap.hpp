@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** SlotMap.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "SlotIndex.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Generational slot map with dense storage
+     *
+     * Values are kept contiguous, in no particular order, for fast iteration;
+     * a SlotIndex maps stable handles to their current position. Insertion,
+     * removal (swap with the last value) and lookup are O(1) and never hash.
+     */
+    template <typename T>
+    class SlotMap {
+        public:
+            using iterator = typename std::vector<T>::iterator;
+            using const_iterator = typename std::vector<T>::const_iterator;
+
+            EntityHandle insert(T value)
+            {
+                _values.push_back(std::move(value));
+                return _index.insert();
+            }
+
+            bool remove(EntityHandle handle)
+            {
+                const std::size_t position = _index.remove(handle);
+                if (position == SlotIndex::NPOS)
+                    return false;
+
+                if (position != _values.size() - 1)
+                    _values[position] = std::move(_values.back());
+                _values.pop_back();
+                return true;
+            }
+
+            [[nodiscard]] bool contains(EntityHandle handle) const { return _index.contains(handle); }
+
+            [[nodiscard]] T *get(EntityHandle handle)
+            {
+                const std::size_t position = _index.find(handle);
+                return position != SlotIndex::NPOS ? &_values[position] : nullptr;
+            }
+
+            [[nodiscard]] const T *get(EntityHandle handle) const
+            {
+                const std::size_t position = _index.find(handle);
+                return position != SlotIndex::NPOS ? &_values[position] : nullptr;
+            }
+
+            [[nodiscard]] std::size_t positionOf(EntityHandle handle) const { return _index.positionOf(handle); }
+            [[nodiscard]] EntityHandle handleForSlot(std::uint32_t index) const { return _index.handleForSlot(index); }
+            [[nodiscard]] EntityHandle handleAt(std::size_t position) const { return _index.handleAt(position); }
+
+            void clear()
+            {
+                _index.clear();
+                _values.clear();
+            }
+
+            [[nodiscard]] std::size_t size() const { return _values.size(); }
+            [[nodiscard]] bool empty() const { return _values.empty(); }
+            [[nodiscard]] std::size_t slotCount() const { return _index.slotCount(); }
+
+            T &operator[](std::size_t position) { return _values[position]; }
+            const T &operator[](std::size_t position) const { return _values[position]; }
+
+            iterator begin() { return _values.begin(); }
+            iterator end() { return _values.end(); }
+            const_iterator begin() const { return _values.begin(); }
+            const_iterator end() const { return _values.end(); }
+
+        private:
+            std::vector<T> _values;
+            SlotIndex _index;
+    };
+} // namespace GUI
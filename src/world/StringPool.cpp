@@ -0,0 +1,90 @@
+/**
+ * @file StringPool.cpp
+ * @brief Implementation of the StringPool class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the StringPool class, which
+ * stores each distinct string once and hands out small handles to it.
+ * Strings are hashed when interned, once per server message that carries
+ * text; reading a string back is an array access.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** StringPool.cpp
+*/
+
+#include "StringPool.hpp"
+
+/**
+ * @brief Constructs a pool holding only the empty string (NONE)
+ */
+GUI::StringPool::StringPool() : _entries(1), _references(1, 0)
+{
+}
+
+/**
+ * @brief Returns a handle to a string, adding the string if it is new
+ *
+ * Each call takes one reference, to be given back with release().
+ *
+ * @param text String to intern
+ * @return The handle, or NONE for the empty string
+ */
+GUI::StringPool::Handle GUI::StringPool::intern(std::string_view text)
+{
+    if (text.empty())
+        return NONE;
+
+    const auto found = _lookup.find(text);
+    if (found != _lookup.end()) {
+        _references[found->second]++;
+        return found->second;
+    }
+
+    Handle handle;
+    if (!_free.empty()) {
+        handle = _free.back();
+        _free.pop_back();
+    } else {
+        handle = static_cast<Handle>(_entries.size());
+        _entries.emplace_back();
+        _references.push_back(0);
+    }
+    _entries[handle] = std::make_shared<const std::string>(text);
+    _references[handle] = 1;
+    _lookup.emplace(std::string_view(*_entries[handle]), handle);
+    _revision++;
+    return handle;
+}
+
+/**
+ * @brief Takes one more reference to an interned string
+ */
+void GUI::StringPool::retain(Handle handle)
+{
+    if (handle != NONE && handle < _entries.size() && _entries[handle])
+        _references[handle]++;
+}
+
+/**
+ * @brief Gives back one reference, freeing the string with the last one
+ *
+ * The entry is only dropped from the pool: snapshots that copied the entry
+ * table keep their own reference to the string.
+ */
+void GUI::StringPool::release(Handle handle)
+{
+    if (handle == NONE || handle >= _entries.size() || !_entries[handle])
+        return;
+    if (--_references[handle] > 0)
+        return;
+
+    _lookup.erase(std::string_view(*_entries[handle]));
+    _entries[handle].reset();
+    _free.push_back(handle);
+    _revision++;
+}
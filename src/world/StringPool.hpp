@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** StringPool.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Interned, reference-counted strings referred to by handle
+     *
+     * Equal strings share one entry, so entities that carry text (broadcast
+     * messages) store a 4-byte handle instead of a std::string. An entry is
+     * freed, and its handle reused, once its last reference is released.
+     *
+     * Each entry is held by a shared pointer to an immutable string: a
+     * snapshot copies the entry table (see getEntries()) and keeps reading
+     * its strings even after the pool reuses their handles.
+     */
+    class StringPool {
+        public:
+            using Handle = std::uint32_t;
+            static constexpr Handle NONE = 0;    // the empty string, never stored
+
+            using Entries = std::vector<std::shared_ptr<const std::string>>;
+
+            StringPool();
+
+            Handle intern(std::string_view text);
+            void retain(Handle handle);
+            void release(Handle handle);
+
+            [[nodiscard]] std::string_view get(Handle handle) const
+            {
+                return handle < _entries.size() && _entries[handle] ? std::string_view(*_entries[handle]) : std::string_view();
+            }
+
+            [[nodiscard]] std::size_t size() const { return _lookup.size(); }
+            [[nodiscard]] const Entries &getEntries() const { return _entries; }
+            [[nodiscard]] std::uint64_t getRevision() const { return _revision; }
+
+        private:
+            Entries _entries;
+            std::vector<std::uint32_t> _references;
+            std::vector<Handle> _free;
+            std::unordered_map<std::string_view, Handle> _lookup;    // views into _entries
+            std::uint64_t _revision = 0;
+    };
+} // namespace GUI
@@ -0,0 +1,69 @@
+/**
+ * @file TeamRegistry.cpp
+ * @brief Implementation of the TeamRegistry class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the TeamRegistry class, which
+ * gives each team name a stable index the first time it is seen. Team names
+ * are only compared when a team or a player is announced, never while
+ * rendering.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** TeamRegistry.cpp
+*/
+
+#include "TeamRegistry.hpp"
+
+/**
+ * @brief Returns the index of a team, registering it if it is new
+ *
+ * A game has a handful of teams, so a linear scan over the names is cheaper
+ * than hashing and keeps the registry a single vector.
+ *
+ * @param name Team name as sent by tna or pnw
+ * @return The team index, or NO_TEAM if the registry is full
+ */
+GUI::TeamRegistry::Index GUI::TeamRegistry::registerTeam(std::string_view name)
+{
+    const Index existing = find(name);
+    if (existing != NO_TEAM)
+        return existing;
+    if (_names.size() >= MAX_TEAMS)
+        return NO_TEAM;
+
+    _names.emplace_back(name);
+    return static_cast<Index>(_names.size() - 1);
+}
+
+/**
+ * @brief Looks a team up by name
+ *
+ * @param name Team name
+ * @return The team index, or NO_TEAM if the team is unknown
+ */
+GUI::TeamRegistry::Index GUI::TeamRegistry::find(std::string_view name) const
+{
+    for (std::size_t i = 0; i < _names.size(); ++i) {
+        if (_names[i] == name)
+            return static_cast<Index>(i);
+    }
+    return NO_TEAM;
+}
+
+/**
+ * @brief Returns the name of a team
+ *
+ * @param team Team index
+ * @return The team name, or an empty string for NO_TEAM or an unknown index
+ */
+const std::string &GUI::TeamRegistry::getName(Index team) const
+{
+    static const std::string none;
+
+    return team < _names.size() ? _names[team] : none;
+}
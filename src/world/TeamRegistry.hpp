@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** TeamRegistry.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Teams of the game, each with a stable index
+     *
+     * Teams are registered from tna (in the order the server lists them) and
+     * from pnw for teams not announced yet. A team keeps its index for the
+     * whole game, so players store the index and renderers keep per-team
+     * attributes in plain arrays indexed by it.
+     */
+    class TeamRegistry {
+        public:
+            using Index = std::uint16_t;
+            static constexpr Index NO_TEAM = 0xFFFF;
+            static constexpr std::size_t MAX_TEAMS = NO_TEAM;
+
+            Index registerTeam(std::string_view name);
+            [[nodiscard]] Index find(std::string_view name) const;
+            [[nodiscard]] const std::string &getName(Index team) const;
+            [[nodiscard]] std::size_t size() const { return _names.size(); }
+            [[nodiscard]] const std::vector<std::string> &getNames() const { return _names; }
+            void clear() { _names.clear(); }
+
+        private:
+            std::vector<std::string> _names;
+    };
+} // namespace GUI
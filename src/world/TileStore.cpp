@@ -0,0 +1,105 @@
+/**
+ * @file TileStore.cpp
+ * @brief Implementation of the TileStore class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the TileStore class, the dense
+ * width x height store of tile resources. It is sized once from msz and then
+ * updated in place by every bct, without allocating.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** TileStore.cpp
+*/
+
+#include "TileStore.hpp"
+#include <algorithm>
+
+/**
+ * @brief Sizes the store for a map and forgets every tile
+ *
+ * @param width Map width in tiles (negative values are treated as 0)
+ * @param height Map height in tiles (negative values are treated as 0)
+ */
+void GUI::TileStore::resize(int width, int height)
+{
+    _width = std::max(width, 0);
+    _height = std::max(height, 0);
+
+    const std::size_t count = static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height);
+    _quantities.assign(count * RESOURCE_COUNT, 0);
+    _known.assign(count, 0);
+    _knownCount = 0;
+}
+
+/**
+ * @brief Forgets every tile, keeping the map size and the memory
+ */
+void GUI::TileStore::clear()
+{
+    std::fill(_quantities.begin(), _quantities.end(), 0);
+    std::fill(_known.begin(), _known.end(), 0);
+    _knownCount = 0;
+}
+
+/**
+ * @brief Returns the memory used by the tile arrays
+ *
+ * @return size_t Bytes allocated for quantities and known flags
+ */
+std::size_t GUI::TileStore::getMemoryUsage() const
+{
+    return _quantities.capacity() * sizeof(Quantity) + _known.capacity();
+}
+
+/**
+ * @brief Stores the content of one tile, as sent by bct
+ *
+ * Quantities are clamped to [0, MAX_QUANTITY].
+ *
+ * @param x Tile column
+ * @param y Tile row
+ * @param quantities Quantity of each resource, food first
+ * @return true if the tile is inside the map, false if it was ignored
+ */
+bool GUI::TileStore::set(int x, int y, const std::array<int, RESOURCE_COUNT> &quantities)
+{
+    if (!contains(x, y))
+        return false;
+
+    const std::size_t tile = index(x, y);
+    const std::size_t stride = _known.size();
+    for (std::size_t r = 0; r < RESOURCE_COUNT; r++)
+        _quantities[r * stride + tile] = static_cast<Quantity>(std::clamp(quantities[r], 0, MAX_QUANTITY));
+
+    if (_known[tile] == 0) {
+        _known[tile] = 1;
+        _knownCount++;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds to, or takes from, the quantity of one resource on a tile
+ *
+ * Used for pgt and pdr, which change a tile without a bct. The result is
+ * clamped to [0, MAX_QUANTITY].
+ *
+ * @param tile Tile index
+ * @param resource Resource index, food first
+ * @param delta Quantity to add (negative to take)
+ * @return false if the change had to be clamped, i.e. the stored quantity
+ *         disagrees with the server
+ */
+bool GUI::TileStore::adjust(std::size_t tile, std::size_t resource, int delta)
+{
+    Quantity &quantity = _quantities[resource * _known.size() + tile];
+    const int result = static_cast<int>(quantity) + delta;
+
+    quantity = static_cast<Quantity>(std::clamp(result, 0, MAX_QUANTITY));
+    return result >= 0 && result <= MAX_QUANTITY;
+}
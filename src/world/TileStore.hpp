@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** TileStore.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GUI {
+
+    /**
+     * @brief Resource quantities of every tile of the map
+     *
+     * Tiles are stored densely, row by row (index = y * width + x), and each
+     * resource has its own contiguous array of 16-bit quantities, so a bct
+     * update is a handful of indexed stores and a full scan reads memory
+     * linearly. A 1000x1000 map takes 15 MB.
+     */
+    class TileStore {
+        public:
+            static constexpr std::size_t RESOURCE_COUNT = 7;
+            using Quantity = std::uint16_t;
+            static constexpr int MAX_QUANTITY = 0xFFFF;
+
+            TileStore() = default;
+
+            void resize(int width, int height);
+            void clear();
+
+            [[nodiscard]] int getWidth() const { return _width; }
+            [[nodiscard]] int getHeight() const { return _height; }
+            [[nodiscard]] std::size_t size() const { return _known.size(); }
+            [[nodiscard]] std::size_t getKnownCount() const { return _knownCount; }
+            [[nodiscard]] std::size_t getMemoryUsage() const;
+
+            [[nodiscard]] bool contains(int x, int y) const
+            {
+                return x >= 0 && y >= 0 && x < _width && y < _height;
+            }
+
+            [[nodiscard]] std::size_t index(int x, int y) const
+            {
+                return static_cast<std::size_t>(y) * static_cast<std::size_t>(_width) + static_cast<std::size_t>(x);
+            }
+
+            bool set(int x, int y, const std::array<int, RESOURCE_COUNT> &quantities);
+            bool adjust(std::size_t tile, std::size_t resource, int delta);
+
+            [[nodiscard]] bool isKnown(std::size_t tile) const { return _known[tile] != 0; }
+
+            [[nodiscard]] Quantity get(std::size_t resource, std::size_t tile) const
+            {
+                return _quantities[resource * _known.size() + tile];
+            }
+
+            [[nodiscard]] const Quantity *resource(std::size_t resource) const
+            {
+                return _quantities.data() + resource * _known.size();
+            }
+
+        private:
+            int _width = 0;
+            int _height = 0;
+            std::size_t _knownCount = 0;
+            std::vector<Quantity> _quantities;
+            std::vector<std::uint8_t> _known;
+    };
+} // namespace GUI
@@ -0,0 +1,711 @@
+/**
+ * @file World.cpp
+ * @brief Implementation of the World class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the World class, the single owner
+ * of the tiles, players and eggs received from the server. Each mutation
+ * increments the world version and marks the tile chunk or entity page it
+ * touched, so publish() only copies what changed into the next snapshot.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** World.cpp
+*/
+
+#include "World.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+/**
+ * @brief Returns the chunk holding a tile
+ */
+static std::size_t chunk_of(int x, int y, int width)
+{
+    const int chunksX = (width + GUI::TileChunk::CHUNK_SIZE - 1) / GUI::TileChunk::CHUNK_SIZE;
+
+    return static_cast<std::size_t>(y / GUI::TileChunk::CHUNK_SIZE) * static_cast<std::size_t>(chunksX)
+        + static_cast<std::size_t>(x / GUI::TileChunk::CHUNK_SIZE);
+}
+
+/**
+ * @brief Returns the snapshot page holding a dense entity position
+ */
+static std::size_t page_of(std::size_t position)
+{
+    return position / GUI::WorldSnapshot::PAGE_SIZE;
+}
+
+/**
+ * @brief Brings the pages of a snapshot up to date with a slot map
+ *
+ * Only the pages marked dirty are copied; the others keep pointing to the
+ * pages of the previous snapshot.
+ *
+ * @param values Entities, in dense order
+ * @param dirty Pages touched since the previous publish; cleared on return
+ * @param pages Pages copied from the previous snapshot, updated in place
+ */
+template <typename T>
+static void publish_pages(const GUI::SlotMap<T> &values, GUI::DirtyList &dirty,
+    std::vector<std::shared_ptr<const GUI::WorldSnapshot::Page<T>>> &pages)
+{
+    const std::size_t size = values.size();
+    const std::size_t count = (size + GUI::WorldSnapshot::PAGE_SIZE - 1) / GUI::WorldSnapshot::PAGE_SIZE;
+
+    pages.resize(count);
+    for (std::size_t page : dirty.list) {
+        if (page >= count)
+            continue;
+        const auto begin = values.begin() + static_cast<std::ptrdiff_t>(page * GUI::WorldSnapshot::PAGE_SIZE);
+        const auto end = values.begin() + static_cast<std::ptrdiff_t>(std::min(size, (page + 1) * GUI::WorldSnapshot::PAGE_SIZE));
+        pages[page] = std::make_shared<const GUI::WorldSnapshot::Page<T>>(begin, end);
+    }
+    dirty.clear();
+}
+
+/**
+ * @brief Brings the player pages of a snapshot up to date with the table
+ *
+ * Same as the slot map version, except that a page holds a range of rows
+ * of every column.
+ */
+static void publish_pages(const GUI::PlayerTable &players, GUI::DirtyList &dirty,
+    std::vector<std::shared_ptr<const GUI::PlayerColumns>> &pages)
+{
+    const std::size_t size = players.size();
+    const std::size_t count = (size + GUI::WorldSnapshot::PAGE_SIZE - 1) / GUI::WorldSnapshot::PAGE_SIZE;
+
+    pages.resize(count);
+    for (std::size_t page : dirty.list) {
+        if (page >= count)
+            continue;
+        auto copy = std::make_shared<GUI::PlayerColumns>();
+        copy->assign(players.getColumns(), page * GUI::WorldSnapshot::PAGE_SIZE,
+            std::min(size, (page + 1) * GUI::WorldSnapshot::PAGE_SIZE));
+        pages[page] = std::move(copy);
+    }
+    dirty.clear();
+}
+
+/**
+ * @brief Sizes the world for a new map
+ *
+ * Every tile is forgotten and the next snapshot starts a new epoch, so
+ * readers rebuild their caches from scratch. Players and eggs are kept, and
+ * indexed again on the tiles of the new map. The map fence stays up until
+ * every tile of the new map was received (see isAwaitingTiles()).
+ *
+ * @param width Map width in tiles
+ * @param height Map height in tiles
+ */
+void GUI::World::resize(int width, int height)
+{
+    _tiles.resize(width, height);
+    _stats.clearTiles();
+    _dirtyChunks.clear();
+
+    _playerTiles.resize(_tiles.size());
+    _eggTiles.resize(_tiles.size());
+    for (std::size_t position = 0; position < _players.size(); position++)
+        placePlayer(_players.handleAt(position));
+    for (std::size_t position = 0; position < _eggs.size(); position++)
+        placeEgg(_eggs.handleAt(position));
+    _resized = true;
+    _awaitingTiles = _tiles.size() > 0;
+    _epoch++;
+    _version++;
+}
+
+/**
+ * @brief Stores the content of a tile and marks it dirty
+ *
+ * bct is authoritative: if the tile was already known, the difference with
+ * the locally maintained content (pgt, pdr, respawns the server does not
+ * announce) is recorded as drift. The map fence falls once every tile is
+ * known.
+ *
+ * @param x Tile column
+ * @param y Tile row
+ * @param quantities Quantity of each resource, food first
+ * @return false if the tile is outside the map
+ */
+bool GUI::World::setTile(int x, int y, const std::array<int, TileStore::RESOURCE_COUNT> &quantities)
+{
+    if (!_tiles.contains(x, y))
+        return false;
+
+    const std::size_t tile = _tiles.index(x, y);
+    std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> stored;
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++)
+        stored[r] = _tiles.get(r, tile);
+    _stats.removeTile(stored);
+
+    const bool known = _tiles.isKnown(tile);
+    std::uint64_t drift = 0;
+    _tiles.set(x, y, quantities);
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++) {
+        const TileStore::Quantity received = _tiles.get(r, tile);
+        drift += static_cast<std::uint64_t>(std::abs(static_cast<int>(received) - static_cast<int>(stored[r])));
+        stored[r] = received;
+    }
+    _stats.addTile(stored);
+    if (known)
+        _stats.recordTileCheck(drift);
+
+    _dirtyChunks.mark(chunk_of(x, y, _tiles.getWidth()));
+    if (_tiles.getKnownCount() == _tiles.size())
+        _awaitingTiles = false;
+    _version++;
+    return true;
+}
+
+/**
+ * @brief Registers a team announced by tna or pnw
+ *
+ * New teams are published with the next snapshot, so renderers can prepare
+ * their per-team attributes once.
+ *
+ * @param name Team name
+ * @return The stable index of the team, or TeamRegistry::NO_TEAM if the
+ *         registry is full
+ */
+GUI::TeamRegistry::Index GUI::World::registerTeam(std::string_view name)
+{
+    const std::size_t before = _teams.size();
+    const TeamRegistry::Index team = _teams.registerTeam(name);
+
+    if (_teams.size() != before) {
+        _stats.addTeam();
+        _teamsChanged = true;
+        _version++;
+    }
+    return team;
+}
+
+/**
+ * @brief Adds a player, or replaces the player with the same id
+ *
+ * A replaced player is reported as removed then added, so handles to the
+ * previous one become stale.
+ *
+ * @param id Player number
+ * @param x Column of the player's tile
+ * @param y Row of the player's tile
+ * @param team Team index, from registerTeam()
+ * @param orientation 1 to 4 (N, E, S, W)
+ * @param level Elevation level
+ * @return false if the id is negative or above MAX_ENTITY_ID
+ */
+bool GUI::World::addPlayer(int id, int x, int y, TeamRegistry::Index team, int orientation, int level)
+{
+    if (id < 0 || id >= MAX_ENTITY_ID)
+        return false;
+
+    removePlayer(id);
+    _stats.addPlayer(team, level);
+    const EntityHandle handle = _players.insert(id, x, y, team, orientation, level);
+    bind(_playerById, id, handle);
+    placePlayer(handle);
+    _dirtyPlayerPages.mark(page_of(_players.positionOf(handle)));
+    _version++;
+    return true;
+}
+
+/**
+ * @brief Moves and turns a player
+ *
+ * A player changing tiles is moved in the occupancy index, which may
+ * change the stack rank of one player left behind.
+ *
+ * @return false if the player is unknown
+ */
+bool GUI::World::movePlayer(int id, int x, int y, int orientation)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    const bool moved = x != players.x[row] || y != players.y[row];
+    players.orientation[row] = static_cast<std::uint8_t>(std::clamp(orientation, 0, 0xFF));
+    if (moved) {
+        unplacePlayer(handle);
+        players.x[row] = static_cast<std::uint16_t>(std::clamp(x, 0, 0xFFFF));
+        players.y[row] = static_cast<std::uint16_t>(std::clamp(y, 0, 0xFFFF));
+        placePlayer(handle);
+    }
+    playerChanged(handle);
+    return true;
+}
+
+/**
+ * @brief Sets the level of a player
+ *
+ * @return false if the player is unknown
+ */
+bool GUI::World::setPlayerLevel(int id, int level)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    _stats.changeLevel(players.team[row], players.level[row], level);
+    players.level[row] = static_cast<std::uint8_t>(std::clamp(level, 0, 0xFF));
+    playerChanged(handle);
+    return true;
+}
+
+/**
+ * @brief Sets the inventory of a player
+ *
+ * pin is authoritative: if the inventory was already known, the difference
+ * with the locally maintained one is recorded as drift. Food is left out of
+ * the comparison, as players eat without the server announcing it.
+ *
+ * @return false if the player is unknown
+ */
+bool GUI::World::setPlayerInventory(int id, const std::array<int, TileStore::RESOURCE_COUNT> &inventory)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    PlayerColumns::Inventory &local = players.inventory[row];
+    if (players.has(row, PlayerColumns::HAS_INVENTORY)) {
+        std::uint64_t drift = 0;
+        for (std::size_t r = 1; r < TileStore::RESOURCE_COUNT; r++)
+            drift += static_cast<std::uint64_t>(std::abs(inventory[r] - static_cast<int>(local[r])));
+        _stats.recordInventoryCheck(drift);
+    }
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++)
+        local[r] = static_cast<PlayerColumns::Quantity>(std::clamp(inventory[r], 0, 0xFFFF));
+    players.flags[row] |= PlayerColumns::HAS_INVENTORY;
+    playerChanged(handle);
+    return true;
+}
+
+/**
+ * @brief Moves one unit of a resource between a player and its tile
+ *
+ * Applies pgt (@p toPlayer true) or pdr locally, so tiles and inventories
+ * stay current without a bct or pin. The tile is only updated once it is
+ * known, and the inventory once a pin was received; a move that would make
+ * a quantity negative is clamped and counted as a local conflict, to be
+ * fixed by the next reconciliation.
+ *
+ * @param id Player number
+ * @param resource Resource index, food first
+ * @param toPlayer true for pgt (tile to inventory), false for pdr
+ * @return false if the player or the resource is unknown
+ */
+bool GUI::World::moveResource(int id, int resource, bool toPlayer)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS || resource < 0 || resource >= static_cast<int>(TileStore::RESOURCE_COUNT))
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    const std::size_t r = static_cast<std::size_t>(resource);
+    const int x = players.x[row];
+    const int y = players.y[row];
+    if (_tiles.contains(x, y) && _tiles.isKnown(_tiles.index(x, y))) {
+        const std::size_t tile = _tiles.index(x, y);
+        std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> stored{};
+        stored[r] = _tiles.get(r, tile);
+        _stats.removeTile(stored);
+        if (!_tiles.adjust(tile, r, toPlayer ? -1 : 1))
+            _stats.recordLocalConflict();
+        stored[r] = _tiles.get(r, tile);
+        _stats.addTile(stored);
+        _dirtyChunks.mark(chunk_of(x, y, _tiles.getWidth()));
+    }
+    if (players.has(row, PlayerColumns::HAS_INVENTORY)) {
+        PlayerColumns::Quantity &held = players.inventory[row][r];
+        if (toPlayer && held < 0xFFFF)
+            held++;
+        else if (!toPlayer && held > 0)
+            held--;
+        else
+            _stats.recordLocalConflict();
+    }
+
+    playerChanged(handle);
+    return true;
+}
+
+/**
+ * @brief Applies pgt: a player took one unit of a resource from its tile
+ *
+ * @return false if the player or the resource is unknown
+ */
+bool GUI::World::collectResource(int id, int resource)
+{
+    return moveResource(id, resource, true);
+}
+
+/**
+ * @brief Applies pdr: a player dropped one unit of a resource on its tile
+ *
+ * @return false if the player or the resource is unknown
+ */
+bool GUI::World::dropResource(int id, int resource)
+{
+    return moveResource(id, resource, false);
+}
+
+/**
+ * @brief Shows a broadcast message above a player
+ *
+ * The text is interned in the string pool; the player's previous message
+ * gives its reference back.
+ *
+ * @return false if the player is unknown
+ */
+bool GUI::World::setPlayerBroadcast(int id, std::string_view message)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    const StringPool::Handle text = _strings.intern(message);
+    _strings.release(players.broadcast[row]);
+    players.broadcast[row] = text;
+    players.broadcastTime[row] = std::chrono::steady_clock::now();
+    playerChanged(handle);
+    return true;
+}
+
+/**
+ * @brief Marks a player as taking part in an incantation (pic) or not
+ *
+ * @return false if the player is unknown
+ */
+bool GUI::World::setPlayerIncanting(int id, bool incanting)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    PlayerColumns &players = _players.getColumns();
+    if (players.has(row, PlayerColumns::INCANTING) != incanting) {
+        players.flags[row] ^= PlayerColumns::INCANTING;
+        playerChanged(handle);
+    }
+    return true;
+}
+
+/**
+ * @brief Ends the incantation on a tile (pie)
+ *
+ * Only the players standing on the tile are visited, through the
+ * occupancy index.
+ *
+ * @return Number of players that were incanting there
+ */
+std::size_t GUI::World::endIncantation(int x, int y)
+{
+    std::size_t ended = 0;
+
+    if (!_tiles.contains(x, y))
+        return 0;
+    PlayerColumns &players = _players.getColumns();
+    _playerTiles.forEach(_tiles.index(x, y), [&](std::uint32_t slot) {
+        const std::size_t row = _players.rowOfSlot(slot);
+        if (players.has(row, PlayerColumns::INCANTING)) {
+            players.flags[row] &= static_cast<std::uint8_t>(~PlayerColumns::INCANTING);
+            _dirtyPlayerPages.mark(page_of(row));
+            ended++;
+        }
+    });
+    if (ended > 0)
+        _version++;
+    return ended;
+}
+
+/**
+ * @brief Removes a dead player
+ *
+ * The player's slot gets a new generation, so every handle to it becomes
+ * stale. The last player is moved into the freed position, so both pages
+ * are marked.
+ *
+ * @return false if the player was unknown or already removed
+ */
+bool GUI::World::removePlayer(int id)
+{
+    const EntityHandle handle = findPlayerHandle(id);
+    const std::size_t row = _players.find(handle);
+    if (row == PlayerTable::NPOS)
+        return false;
+
+    const PlayerColumns &players = _players.getColumns();
+    _stats.removePlayer(players.team[row], players.level[row]);
+    _strings.release(players.broadcast[row]);
+    unplacePlayer(handle);
+    _dirtyPlayerPages.mark(page_of(_players.positionOf(handle)));
+    _dirtyPlayerPages.mark(page_of(_players.size() - 1));
+    _players.remove(handle);
+    _playerById[static_cast<std::size_t>(id)] = EntityHandle{};
+    _version++;
+    return true;
+}
+
+/**
+ * @brief Adds an egg, or replaces the egg with the same id
+ *
+ * The egg is counted for the team of the player who laid it, if known.
+ *
+ * @param egg Egg as announced by enw
+ * @return false if the id is negative or above MAX_ENTITY_ID
+ */
+bool GUI::World::addEgg(const EggInfo &egg)
+{
+    if (egg.id < 0 || egg.id >= MAX_ENTITY_ID)
+        return false;
+
+    removeEgg(egg.id);
+    EggInfo stored = egg;
+    const std::size_t layer = findPlayerRow(egg.player_id);
+    stored.team = layer != PlayerTable::NPOS ? _players.getColumns().team[layer] : WorldStats::NO_TEAM;
+    _stats.addEgg(stored.team);
+
+    const EntityHandle handle = _eggs.insert(stored);
+    bind(_eggById, egg.id, handle);
+    placeEgg(handle);
+    _dirtyEggPages.mark(page_of(_eggs.positionOf(handle)));
+    _version++;
+    return true;
+}
+
+/**
+ * @brief Removes a hatched or dead egg
+ *
+ * @return false if the egg was unknown or already removed
+ */
+bool GUI::World::removeEgg(int id)
+{
+    const EntityHandle handle = findEggHandle(id);
+    const EggInfo *egg = _eggs.get(handle);
+    if (egg == nullptr)
+        return false;
+
+    _stats.removeEgg(egg->team);
+    if (_eggTiles.contains(handle.index))
+        _eggTiles.remove(handle.index);
+    _dirtyEggPages.mark(page_of(_eggs.positionOf(handle)));
+    _dirtyEggPages.mark(page_of(_eggs.size() - 1));
+    _eggs.remove(handle);
+    _eggById[static_cast<std::size_t>(id)] = EntityHandle{};
+    _version++;
+    return true;
+}
+
+/**
+ * @brief Returns the handle of a player
+ *
+ * @param id Player number
+ * @return The handle, or an invalid handle if the player is unknown
+ */
+GUI::EntityHandle GUI::World::findPlayerHandle(int id) const
+{
+    return lookup(_playerById, id);
+}
+
+/**
+ * @brief Returns the handle of an egg
+ *
+ * @param id Egg number
+ * @return The handle, or an invalid handle if the egg is unknown
+ */
+GUI::EntityHandle GUI::World::findEggHandle(int id) const
+{
+    return lookup(_eggById, id);
+}
+
+/**
+ * @brief Reads an id to handle index
+ */
+GUI::EntityHandle GUI::World::lookup(const std::vector<EntityHandle> &index, int id)
+{
+    if (id < 0 || static_cast<std::size_t>(id) >= index.size())
+        return EntityHandle{};
+    return index[static_cast<std::size_t>(id)];
+}
+
+/**
+ * @brief Writes an id to handle index, growing it as needed
+ */
+bool GUI::World::bind(std::vector<EntityHandle> &index, int id, EntityHandle handle)
+{
+    if (id < 0 || id >= MAX_ENTITY_ID)
+        return false;
+    if (static_cast<std::size_t>(id) >= index.size())
+        index.resize(std::max(static_cast<std::size_t>(id) + 1, index.size() * 2));
+    index[static_cast<std::size_t>(id)] = handle;
+    return true;
+}
+
+/**
+ * @brief Records that an existing player changed
+ */
+void GUI::World::playerChanged(EntityHandle handle)
+{
+    _dirtyPlayerPages.mark(page_of(_players.positionOf(handle)));
+    _version++;
+}
+
+/**
+ * @brief Links a player to the occupancy list of its tile
+ *
+ * The player takes the last stack rank of the tile. Players standing
+ * outside the map (before msz, or after a smaller one) are not indexed.
+ */
+void GUI::World::placePlayer(EntityHandle handle)
+{
+    const std::size_t row = _players.positionOf(handle);
+    const PlayerColumns &players = _players.getColumns();
+    const int x = players.x[row];
+    const int y = players.y[row];
+
+    if (!_tiles.contains(x, y)) {
+        setStack(row, 0);
+        return;
+    }
+    _playerTiles.insert(handle.index, _tiles.index(x, y));
+    setStack(row, _playerTiles.getRank(handle.index));
+}
+
+/**
+ * @brief Unlinks a player from the occupancy list of its tile
+ *
+ * The last player of the tile takes the stack rank of the removed one.
+ */
+void GUI::World::unplacePlayer(EntityHandle handle)
+{
+    if (!_playerTiles.contains(handle.index))
+        return;
+
+    const std::uint32_t moved = _playerTiles.remove(handle.index);
+    if (moved != OccupancyIndex::NONE)
+        setStack(_players.rowOfSlot(moved), _playerTiles.getRank(moved));
+}
+
+/**
+ * @brief Stores the stack rank of a player and marks its page
+ *
+ * Ranks above 255 are stored as 255; the renderer only spreads the first
+ * few players of a tile anyway.
+ */
+void GUI::World::setStack(std::size_t row, std::uint32_t rank)
+{
+    _players.getColumns().stack[row] = static_cast<std::uint8_t>(std::min<std::uint32_t>(rank, 0xFF));
+    _dirtyPlayerPages.mark(page_of(row));
+}
+
+/**
+ * @brief Links an egg to the occupancy list of its tile, if on the map
+ */
+void GUI::World::placeEgg(EntityHandle handle)
+{
+    const EggInfo *egg = _eggs.get(handle);
+
+    if (_tiles.contains(egg->x, egg->y))
+        _eggTiles.insert(handle.index, _tiles.index(egg->x, egg->y));
+}
+
+/**
+ * @brief Copies the tiles of one chunk out of the tile store
+ *
+ * @param chunk Chunk index, row by row
+ * @param chunksX Number of chunks per row
+ * @param out Chunk to fill; tiles outside the map are left untouched
+ */
+void GUI::World::copyChunk(std::size_t chunk, int chunksX, TileChunk &out) const
+{
+    const int x0 = static_cast<int>(chunk % static_cast<std::size_t>(chunksX)) * TileChunk::CHUNK_SIZE;
+    const int y0 = static_cast<int>(chunk / static_cast<std::size_t>(chunksX)) * TileChunk::CHUNK_SIZE;
+    const int columns = std::min(TileChunk::CHUNK_SIZE, _tiles.getWidth() - x0);
+    const int rows = std::min(TileChunk::CHUNK_SIZE, _tiles.getHeight() - y0);
+
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++) {
+        const TileStore::Quantity *plane = _tiles.resource(r);
+        for (int row = 0; row < rows; row++) {
+            const TileStore::Quantity *source = plane + _tiles.index(x0, y0 + row);
+            std::copy(source, source + columns, out.quantities[r].begin() + row * TileChunk::CHUNK_SIZE);
+        }
+    }
+}
+
+/**
+ * @brief Publishes the current state as an immutable snapshot
+ *
+ * The new snapshot starts as a copy of the previous one's chunk and page
+ * pointers; only the chunks and pages marked since then are copied from the
+ * World. After a resize every chunk points to one shared empty chunk until
+ * its first bct. The cost is therefore proportional to the number of
+ * changed chunks and pages, plus one pointer copy per chunk and a copy of
+ * the aggregates. The string table is copied (one pointer per string) only
+ * when a string was added or freed.
+ *
+ * @return The snapshot, safe to hand to another thread
+ */
+std::shared_ptr<const GUI::WorldSnapshot> GUI::World::publish()
+{
+    static const std::shared_ptr<const TileChunk> emptyChunk = std::make_shared<const TileChunk>();
+
+    auto snapshot = _published ? std::make_shared<WorldSnapshot>(*_published) : std::make_shared<WorldSnapshot>();
+    const int chunksX = (_tiles.getWidth() + TileChunk::CHUNK_SIZE - 1) / TileChunk::CHUNK_SIZE;
+    const int chunksY = (_tiles.getHeight() + TileChunk::CHUNK_SIZE - 1) / TileChunk::CHUNK_SIZE;
+
+    if (_resized) {
+        snapshot->_width = _tiles.getWidth();
+        snapshot->_height = _tiles.getHeight();
+        snapshot->_chunksX = chunksX;
+        snapshot->_chunksY = chunksY;
+        snapshot->_chunks.assign(static_cast<std::size_t>(chunksX) * static_cast<std::size_t>(chunksY), emptyChunk);
+        _resized = false;
+    }
+    for (std::size_t chunk : _dirtyChunks.list) {
+        auto copy = std::make_shared<TileChunk>();
+        copyChunk(chunk, chunksX, *copy);
+        snapshot->_chunks[chunk] = std::move(copy);
+    }
+    _dirtyChunks.clear();
+
+    if (_teamsChanged) {
+        snapshot->_teams = std::make_shared<const std::vector<std::string>>(_teams.getNames());
+        _teamsChanged = false;
+    }
+    if (_strings.getRevision() != _publishedStrings) {
+        snapshot->_strings = std::make_shared<const StringPool::Entries>(_strings.getEntries());
+        _publishedStrings = _strings.getRevision();
+    }
+    publish_pages(_players, _dirtyPlayerPages, snapshot->_playerPages);
+    publish_pages(_eggs, _dirtyEggPages, snapshot->_eggPages);
+
+    snapshot->_knownCount = _tiles.getKnownCount();
+    snapshot->_playerCount = _players.size();
+    snapshot->_eggCount = _eggs.size();
+    snapshot->_stats = _stats;
+    snapshot->_version = _version;
+    snapshot->_epoch = _epoch;
+
+    _published = snapshot;
+    _publishedVersion = _version;
+    return snapshot;
+}
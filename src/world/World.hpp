@@ -0,0 +1,197 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** World.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "OccupancyIndex.hpp"
+#include "SlotMap.hpp"
+#include "StringPool.hpp"
+#include "TeamRegistry.hpp"
+#include "TileStore.hpp"
+#include "WorldSnapshot.hpp"
+#include "WorldStats.hpp"
+#include "../player/PlayerTable.hpp"
+
+namespace GUI {
+
+    /**
+     * @brief Set of indices marked since the last clear(), each listed once
+     */
+    struct DirtyList {
+        std::vector<std::uint8_t> flags;
+        std::vector<std::size_t> list;
+
+        void mark(std::size_t index)
+        {
+            if (index >= flags.size())
+                flags.resize(index + 1, 0);
+            if (flags[index] == 0) {
+                flags[index] = 1;
+                list.push_back(index);
+            }
+        }
+
+        void clear()
+        {
+            for (std::size_t index : list)
+                flags[index] = 0;
+            list.clear();
+        }
+    };
+
+    /**
+     * @brief Game state built from the server messages
+     *
+     * World is the writer side of the game state: it is owned by the ingest
+     * thread, which applies every server message to it. Each mutation bumps
+     * a version number and marks the tile chunk or entity page it touched;
+     * publish() then produces an immutable WorldSnapshot that shares every
+     * unmarked chunk and page with the previous one. Readers (the renderer)
+     * only ever see published snapshots, never the World itself.
+     *
+     * Players live in a PlayerTable (one column per attribute, broadcast
+     * texts interned in a StringPool) and eggs in a slot map. Server ids ("#n", parsed to n) are
+     * small increasing integers, so the id to handle index is a plain vector
+     * indexed by id: no lookup hashes anything.
+     *
+     * Players and eggs are also indexed by tile (see OccupancyIndex), kept
+     * up to date on every add, move and removal, so listing what stands on
+     * a tile never scans the entities.
+     *
+     * Aggregates (resource totals, players, eggs and levels per team) are
+     * adjusted by each mutation in a WorldStats and published with the
+     * snapshot, so they never need a scan.
+     *
+     * resize() opens a map fence: the content of the new map (the reply to
+     * mct, one bct per tile) is outstanding until every tile was received.
+     * The publisher holds snapshots while isAwaitingTiles() is true, so no
+     * reader sees a half-filled map.
+     */
+    class World {
+        public:
+            static constexpr int MAX_ENTITY_ID = 1 << 24;
+
+            World() = default;
+
+            void resize(int width, int height);
+            bool setTile(int x, int y, const std::array<int, TileStore::RESOURCE_COUNT> &quantities);
+
+            TeamRegistry::Index registerTeam(std::string_view name);
+
+            bool addPlayer(int id, int x, int y, TeamRegistry::Index team, int orientation, int level);
+            bool movePlayer(int id, int x, int y, int orientation);
+            bool setPlayerLevel(int id, int level);
+            bool setPlayerInventory(int id, const std::array<int, TileStore::RESOURCE_COUNT> &inventory);
+            bool setPlayerBroadcast(int id, std::string_view message);
+            bool setPlayerIncanting(int id, bool incanting);
+            std::size_t endIncantation(int x, int y);
+            bool collectResource(int id, int resource);
+            bool dropResource(int id, int resource);
+            bool removePlayer(int id);
+
+            bool addEgg(const EggInfo &egg);
+            bool removeEgg(int id);
+
+            [[nodiscard]] int getWidth() const { return _tiles.getWidth(); }
+            [[nodiscard]] int getHeight() const { return _tiles.getHeight(); }
+            [[nodiscard]] const TileStore &getTiles() const { return _tiles; }
+            [[nodiscard]] const TeamRegistry &getTeams() const { return _teams; }
+            [[nodiscard]] const WorldStats &getStats() const { return _stats; }
+            [[nodiscard]] const PlayerTable &getPlayers() const { return _players; }
+            [[nodiscard]] const StringPool &getStrings() const { return _strings; }
+            [[nodiscard]] const SlotMap<EggInfo> &getEggs() const { return _eggs; }
+            [[nodiscard]] EntityHandle findPlayerHandle(int id) const;
+            [[nodiscard]] EntityHandle findEggHandle(int id) const;
+            [[nodiscard]] std::size_t findPlayerRow(int id) const { return _players.find(findPlayerHandle(id)); }
+            [[nodiscard]] const EggInfo *getEgg(EntityHandle handle) const { return _eggs.get(handle); }
+
+            [[nodiscard]] std::size_t countPlayersOn(int x, int y) const
+            {
+                return _tiles.contains(x, y) ? _playerTiles.count(_tiles.index(x, y)) : 0;
+            }
+
+            [[nodiscard]] std::size_t countEggsOn(int x, int y) const
+            {
+                return _tiles.contains(x, y) ? _eggTiles.count(_tiles.index(x, y)) : 0;
+            }
+
+            /**
+             * @brief Calls @p function(row) for each player on a tile
+             *
+             * @p row indexes the columns of getPlayers().getColumns().
+             */
+            template <typename Function>
+            void forEachPlayerOn(int x, int y, Function &&function) const
+            {
+                if (!_tiles.contains(x, y))
+                    return;
+                _playerTiles.forEach(_tiles.index(x, y), [&](std::uint32_t slot) {
+                    function(_players.rowOfSlot(slot));
+                });
+            }
+
+            /**
+             * @brief Calls @p function(handle, egg) for each egg on a tile
+             */
+            template <typename Function>
+            void forEachEggOn(int x, int y, Function &&function) const
+            {
+                if (!_tiles.contains(x, y))
+                    return;
+                _eggTiles.forEach(_tiles.index(x, y), [&](std::uint32_t slot) {
+                    const EntityHandle handle = _eggs.handleForSlot(slot);
+                    function(handle, *_eggs.get(handle));
+                });
+            }
+
+            [[nodiscard]] std::uint64_t getVersion() const { return _version; }
+            [[nodiscard]] bool hasUnpublishedChanges() const { return _version != _publishedVersion; }
+            [[nodiscard]] bool isAwaitingTiles() const { return _awaitingTiles; }
+            void releaseTileFence() { _awaitingTiles = false; }
+            std::shared_ptr<const WorldSnapshot> publish();
+
+        private:
+            static EntityHandle lookup(const std::vector<EntityHandle> &index, int id);
+            static bool bind(std::vector<EntityHandle> &index, int id, EntityHandle handle);
+            void playerChanged(EntityHandle handle);
+            bool moveResource(int id, int resource, bool toPlayer);
+            void placePlayer(EntityHandle handle);
+            void unplacePlayer(EntityHandle handle);
+            void setStack(std::size_t row, std::uint32_t rank);
+            void placeEgg(EntityHandle handle);
+            void copyChunk(std::size_t chunk, int chunksX, TileChunk &out) const;
+
+            TileStore _tiles;
+            TeamRegistry _teams;
+            PlayerTable _players;
+            StringPool _strings;
+            SlotMap<EggInfo> _eggs;
+            std::vector<EntityHandle> _playerById;
+            std::vector<EntityHandle> _eggById;
+            WorldStats _stats;
+            OccupancyIndex _playerTiles;
+            OccupancyIndex _eggTiles;
+
+            std::uint64_t _version = 0;
+            std::uint64_t _epoch = 0;
+            std::uint64_t _publishedVersion = 0;
+            std::shared_ptr<const WorldSnapshot> _published;
+            bool _resized = false;
+            bool _awaitingTiles = false;
+            bool _teamsChanged = false;
+            std::uint64_t _publishedStrings = 0;
+            DirtyList _dirtyChunks;
+            DirtyList _dirtyPlayerPages;
+            DirtyList _dirtyEggPages;
+    };
+} // namespace GUI
@@ -0,0 +1,168 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** WorldSnapshot.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "TileStore.hpp"
+#include "WorldStats.hpp"
+#include "StringPool.hpp"
+#include "../player/PlayerTable.hpp"
+
+namespace GUI {
+
+    struct EggInfo {
+        int id;
+        int player_id;
+        int x, y;
+        std::uint16_t team = 0xFFFF;    // team of the player who laid it, set by World::addEgg()
+    };
+
+    /**
+     * @brief Resources of a square block of CHUNK_SIZE x CHUNK_SIZE tiles
+     *
+     * Tiles are stored row by row inside the chunk; tiles of edge chunks that
+     * fall outside the map stay at 0.
+     */
+    struct TileChunk {
+        static constexpr int CHUNK_SIZE = 32;
+        static constexpr std::size_t CHUNK_TILES = CHUNK_SIZE * CHUNK_SIZE;
+
+        std::array<std::array<TileStore::Quantity, CHUNK_TILES>, TileStore::RESOURCE_COUNT> quantities{};
+    };
+
+    /**
+     * @brief Read-only copy of the world, as published by World::publish()
+     *
+     * Tiles are grouped in chunks and entities in pages of PAGE_SIZE, each
+     * held by a shared pointer to immutable data. A new snapshot shares every
+     * chunk and page that did not change with the previous one, so publishing
+     * only copies what changed, and a reader can tell what changed between two
+     * snapshots by comparing chunk pointers.
+     *
+     * A snapshot never changes once published: the render thread may read it
+     * while the ingest thread applies the next messages to the World.
+     */
+    class WorldSnapshot {
+        public:
+            static constexpr std::size_t PAGE_SIZE = 64;
+
+            template <typename T>
+            using Page = std::vector<T>;
+
+            [[nodiscard]] int getWidth() const { return _width; }
+            [[nodiscard]] int getHeight() const { return _height; }
+            [[nodiscard]] std::size_t getTileCount() const
+            {
+                return static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height);
+            }
+            [[nodiscard]] std::size_t getKnownCount() const { return _knownCount; }
+            [[nodiscard]] std::uint64_t getVersion() const { return _version; }
+            [[nodiscard]] std::uint64_t getEpoch() const { return _epoch; }
+
+            [[nodiscard]] int getChunksX() const { return _chunksX; }
+            [[nodiscard]] int getChunksY() const { return _chunksY; }
+            [[nodiscard]] std::size_t getChunkCount() const { return _chunks.size(); }
+            [[nodiscard]] const TileChunk *getChunk(std::size_t chunk) const { return _chunks[chunk].get(); }
+            [[nodiscard]] std::size_t getMemoryUsage() const { return _chunks.size() * sizeof(TileChunk); }
+
+            [[nodiscard]] TileStore::Quantity get(std::size_t resource, int x, int y) const
+            {
+                const std::size_t chunk = static_cast<std::size_t>(y / TileChunk::CHUNK_SIZE) * static_cast<std::size_t>(_chunksX)
+                    + static_cast<std::size_t>(x / TileChunk::CHUNK_SIZE);
+                const std::size_t offset = static_cast<std::size_t>(y % TileChunk::CHUNK_SIZE) * TileChunk::CHUNK_SIZE
+                    + static_cast<std::size_t>(x % TileChunk::CHUNK_SIZE);
+                return _chunks[chunk]->quantities[resource][offset];
+            }
+
+            [[nodiscard]] const std::vector<std::string> &getTeams() const { return *_teams; }
+            [[nodiscard]] std::size_t getPlayerCount() const { return _playerCount; }
+            [[nodiscard]] std::size_t getPlayerPageCount() const { return _playerPages.size(); }
+            [[nodiscard]] const PlayerColumns *getPlayerPage(std::size_t page) const { return _playerPages[page].get(); }
+            [[nodiscard]] std::size_t getEggCount() const { return _eggCount; }
+            [[nodiscard]] const WorldStats &getStats() const { return _stats; }
+
+            [[nodiscard]] const std::string &getString(StringPool::Handle handle) const
+            {
+                static const std::string empty;
+                return handle < _strings->size() && (*_strings)[handle] ? *(*_strings)[handle] : empty;
+            }
+
+            /**
+             * @brief Calls @p function(columns) for each page of players
+             *
+             * Rows 0 to columns.size() - 1 of a page are players; a pass reads
+             * only the columns it needs.
+             */
+            template <typename Function>
+            void forEachPlayerPage(Function &&function) const
+            {
+                for (const auto &page : _playerPages)
+                    function(static_cast<const PlayerColumns &>(*page));
+            }
+
+            template <typename Function>
+            void forEachEgg(Function &&function) const
+            {
+                for (const auto &page : _eggPages)
+                    for (const EggInfo &egg : *page)
+                        function(egg);
+            }
+
+        private:
+            friend class World;
+
+            int _width = 0;
+            int _height = 0;
+            int _chunksX = 0;
+            int _chunksY = 0;
+            std::size_t _knownCount = 0;
+            std::uint64_t _version = 0;
+            std::uint64_t _epoch = 0;
+
+            std::vector<std::shared_ptr<const TileChunk>> _chunks;
+            std::shared_ptr<const std::vector<std::string>> _teams = std::make_shared<const std::vector<std::string>>();
+            std::shared_ptr<const StringPool::Entries> _strings = std::make_shared<const StringPool::Entries>();
+            std::vector<std::shared_ptr<const PlayerColumns>> _playerPages;
+            std::vector<std::shared_ptr<const Page<EggInfo>>> _eggPages;
+            std::size_t _playerCount = 0;
+            std::size_t _eggCount = 0;
+            WorldStats _stats;
+    };
+
+    /**
+     * @brief Hand-over point of the latest snapshot between two threads
+     *
+     * The writer stores each new snapshot and the reader loads the latest one
+     * once per frame; only a pointer swap happens under the lock. Snapshots a
+     * reader skipped are freed when the last reference goes away.
+     */
+    class SnapshotSlot {
+        public:
+            void store(std::shared_ptr<const WorldSnapshot> snapshot)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _snapshot.swap(snapshot);
+            }
+
+            [[nodiscard]] std::shared_ptr<const WorldSnapshot> load() const
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _snapshot;
+            }
+
+        private:
+            mutable std::mutex _mutex;
+            std::shared_ptr<const WorldSnapshot> _snapshot;
+    };
+} // namespace GUI
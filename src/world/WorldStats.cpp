@@ -0,0 +1,159 @@
+/**
+ * @file WorldStats.cpp
+ * @brief Implementation of the WorldStats class for the ZappyGUI project
+ * @author EPITECH PROJECT, 2025
+ * @date 2025
+ *
+ * This file contains the implementation of the WorldStats class, the
+ * aggregates shown by the information overlay: resource totals, players and
+ * eggs per team and level distributions. They are updated by deltas, never
+ * recomputed.
+ */
+
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** WorldStats.cpp
+*/
+
+#include "WorldStats.hpp"
+#include <algorithm>
+
+/**
+ * @brief Maps a level to its histogram bucket
+ *
+ * @param level Player level as sent by the server
+ * @return The level clamped to [0, MAX_LEVEL]
+ */
+int GUI::WorldStats::levelBucket(int level)
+{
+    return std::clamp(level, 0, TeamStats::MAX_LEVEL);
+}
+
+/**
+ * @brief Returns the counters of a team
+ *
+ * @return The counters, or nullptr for NO_TEAM or an unknown team
+ */
+GUI::TeamStats *GUI::WorldStats::team(std::uint16_t index)
+{
+    return index < _teams.size() ? &_teams[index] : nullptr;
+}
+
+/**
+ * @brief Subtracts the previous content of a tile from the totals
+ */
+void GUI::WorldStats::removeTile(const std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> &quantities)
+{
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++)
+        _resourceTotals[r] -= quantities[r];
+}
+
+/**
+ * @brief Adds the new content of a tile to the totals
+ */
+void GUI::WorldStats::addTile(const std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> &quantities)
+{
+    for (std::size_t r = 0; r < TileStore::RESOURCE_COUNT; r++)
+        _resourceTotals[r] += quantities[r];
+}
+
+/**
+ * @brief Counts a new player
+ *
+ * @param team Team index, or NO_TEAM
+ * @param level Level of the player
+ */
+void GUI::WorldStats::addPlayer(std::uint16_t team, int level)
+{
+    const int bucket = levelBucket(level);
+
+    _levels[bucket]++;
+    if (TeamStats *stats = this->team(team)) {
+        stats->players++;
+        stats->levels[bucket]++;
+    }
+}
+
+/**
+ * @brief Moves a player from one level bucket to another
+ */
+void GUI::WorldStats::changeLevel(std::uint16_t team, int from, int to)
+{
+    const int oldBucket = levelBucket(from);
+    const int newBucket = levelBucket(to);
+
+    _levels[oldBucket]--;
+    _levels[newBucket]++;
+    if (TeamStats *stats = this->team(team)) {
+        stats->levels[oldBucket]--;
+        stats->levels[newBucket]++;
+    }
+}
+
+/**
+ * @brief Stops counting a dead player
+ */
+void GUI::WorldStats::removePlayer(std::uint16_t team, int level)
+{
+    const int bucket = levelBucket(level);
+
+    _levels[bucket]--;
+    if (TeamStats *stats = this->team(team)) {
+        stats->players--;
+        stats->levels[bucket]--;
+    }
+}
+
+/**
+ * @brief Counts a new egg
+ *
+ * @param team Team of the player who laid it, or NO_TEAM
+ */
+void GUI::WorldStats::addEgg(std::uint16_t team)
+{
+    if (TeamStats *stats = this->team(team))
+        stats->eggs++;
+    else
+        _unassignedEggs++;
+}
+
+/**
+ * @brief Stops counting a hatched or dead egg
+ */
+void GUI::WorldStats::removeEgg(std::uint16_t team)
+{
+    if (TeamStats *stats = this->team(team))
+        stats->eggs--;
+    else
+        _unassignedEggs--;
+}
+
+/**
+ * @brief Counts a bct reply for a tile that was already known
+ *
+ * @param units Sum of the differences between the server and local values
+ */
+void GUI::WorldStats::recordTileCheck(std::uint64_t units)
+{
+    _drift.tileChecks++;
+    if (units != 0) {
+        _drift.tileDrifts++;
+        _drift.driftUnits += units;
+    }
+}
+
+/**
+ * @brief Counts a pin reply for an inventory that was already known
+ *
+ * @param units Sum of the differences between the server and local values
+ */
+void GUI::WorldStats::recordInventoryCheck(std::uint64_t units)
+{
+    _drift.inventoryChecks++;
+    if (units != 0) {
+        _drift.inventoryDrifts++;
+        _drift.driftUnits += units;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** ZAPPY GUI
+** File description:
+** WorldStats.hpp
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "TileStore.hpp"
+
+namespace GUI {
+
+    struct TeamStats {
+        static constexpr int MAX_LEVEL = 8;
+
+        int players = 0;
+        int eggs = 0;
+        std::array<int, MAX_LEVEL + 1> levels{};    // levels[n]: players at level n
+    };
+
+    /**
+     * @brief Disagreements found between local updates and the server
+     *
+     * pgt and pdr are applied locally; each bct or pin reply for a tile or
+     * inventory already known is a check, and a check is a drift when the
+     * server's values differ from the local ones.
+     */
+    struct DriftStats {
+        std::uint64_t tileChecks = 0;
+        std::uint64_t tileDrifts = 0;
+        std::uint64_t inventoryChecks = 0;
+        std::uint64_t inventoryDrifts = 0;
+        std::uint64_t driftUnits = 0;       // sum of |server - local| over every drift
+        std::uint64_t localConflicts = 0;   // pgt/pdr that could not be applied as is
+    };
+
+    /**
+     * @brief Aggregates over the whole world, kept up to date on each event
+     *
+     * Every counter is adjusted by the World when a message changes what it
+     * counts (bct, pnw, plv, pdi, enw, ebo, edi), so reading any of them is a
+     * plain load whatever the size of the map or the number of players.
+     */
+    class WorldStats {
+        public:
+            static constexpr std::uint16_t NO_TEAM = 0xFFFF;
+
+            void clearTiles() { _resourceTotals.fill(0); }
+            void removeTile(const std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> &quantities);
+            void addTile(const std::array<TileStore::Quantity, TileStore::RESOURCE_COUNT> &quantities);
+
+            void addTeam() { _teams.emplace_back(); }
+            void addPlayer(std::uint16_t team, int level);
+            void changeLevel(std::uint16_t team, int from, int to);
+            void removePlayer(std::uint16_t team, int level);
+            void addEgg(std::uint16_t team);
+            void removeEgg(std::uint16_t team);
+
+            void recordTileCheck(std::uint64_t units);
+            void recordInventoryCheck(std::uint64_t units);
+            void recordLocalConflict() { _drift.localConflicts++; }
+
+            [[nodiscard]] std::uint64_t getResourceTotal(std::size_t resource) const { return _resourceTotals[resource]; }
+            [[nodiscard]] const std::vector<TeamStats> &getTeams() const { return _teams; }
+            [[nodiscard]] const std::array<int, TeamStats::MAX_LEVEL + 1> &getLevels() const { return _levels; }
+            [[nodiscard]] int getUnassignedEggs() const { return _unassignedEggs; }
+            [[nodiscard]] const DriftStats &getDrift() const { return _drift; }
+
+            static int levelBucket(int level);
+
+        private:
+            TeamStats *team(std::uint16_t index);
+
+            std::array<std::uint64_t, TileStore::RESOURCE_COUNT> _resourceTotals{};
+            std::array<int, TeamStats::MAX_LEVEL + 1> _levels{};
+            std::vector<TeamStats> _teams;
+            int _unassignedEggs = 0;
+            DriftStats _drift;
+    };
+} // namespace GUI